@@ -649,6 +649,19 @@ ifeq ($(strip $(DYNAMIC_KEYMAP_ENABLE)), yes)
     SEND_STRING_ENABLE := yes
 endif
 
+ifeq ($(strip $(SEND_STRING_ASYNC_ENABLE)), yes)
+    SEND_STRING_ENABLE := yes
+    OPT_DEFS += -DSEND_STRING_ASYNC_ENABLE
+    SRC += $(QUANTUM_DIR)/send_string/send_string_async.c
+endif
+
+# Latency tracing and the task scheduler keep their statistics in profiling probes
+ifneq ($(strip $(PROFILING_ENABLE)), yes)
+    ifneq ($(filter yes, $(strip $(LATENCY_TRACE_ENABLE)) $(strip $(TASK_SCHEDULER_ENABLE))),)
+        SRC += $(QUANTUM_DIR)/profiling.c
+    endif
+endif
+
 VALID_CUSTOM_MATRIX_TYPES:= yes lite no
 
 CUSTOM_MATRIX ?= no
@@ -39,12 +39,14 @@ GENERIC_FEATURES = \
     KEYCODE_STRING \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILING \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
@@ -53,6 +55,7 @@ GENERIC_FEATURES = \
     SPACE_CADET \
     SWAP_HANDS \
     TAP_DANCE \
+    TASK_SCHEDULER \
     TRI_LAYER \
     VIA \
     VIRTSER \
@@ -8,6 +8,7 @@ include $(QUANTUM_PATH)/os_detection/tests/testlist.mk
 include $(QUANTUM_PATH)/sequencer/tests/testlist.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/testlist.mk
 include $(PLATFORM_PATH)/test/testlist.mk
+include $(DRIVER_PATH)/led/tests/testlist.mk
 
 define VALIDATE_TEST_LIST
     ifneq ($1,)
@@ -20,6 +20,7 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "../pwm_dirty.h"
 
 #define IS31FL3729_PWM_REGISTER_COUNT 143
 #define IS31FL3729_SCALING_REGISTER_COUNT 16
@@ -81,6 +82,7 @@ const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
 // Storing them like this is optimal for I2C transfers to the registers.
 typedef struct is31fl3729_driver_t {
     uint8_t pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
+    uint8_t pwm_dirty[PWM_DIRTY_SIZE(IS31FL3729_PWM_REGISTER_COUNT)];
     bool    pwm_buffer_dirty;
     uint8_t scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
@@ -88,6 +90,7 @@ typedef struct is31fl3729_driver_t {
 
 is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
+    .pwm_dirty            = {0},
     .pwm_buffer_dirty     = false,
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
@@ -104,17 +107,26 @@ void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 }
 
 void is31fl3729_write_pwm_buffer(uint8_t index) {
-    // Transmit PWM registers in 11 transfers of 13 bytes.
+    // Transmit runs of dirty PWM registers in transfers of up to 13 bytes.
+    uint8_t i = 0;
+    uint8_t length;
 
-    // Iterate over the pwm_buffer contents at 13 byte intervals.
-    for (uint8_t i = 0; i <= IS31FL3729_PWM_REGISTER_COUNT; i += 13) {
+    while ((length = pwm_dirty_next_run(driver_buffers[index].pwm_dirty, IS31FL3729_PWM_REGISTER_COUNT, &i, 13)) > 0) {
 #if IS31FL3729_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+        bool sent = false;
+        for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE && !sent; j++) {
+            sent = i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT);
+        bool sent = i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS;
 #endif
+        if (sent) {
+            pwm_dirty_clear_run(driver_buffers[index].pwm_dirty, i, length);
+        } else {
+            // Leave the run marked and the buffer dirty, so the next update retries it.
+            driver_buffers[index].pwm_buffer_dirty = true;
+        }
+        i += length;
     }
 }
 
@@ -153,6 +165,10 @@ void is31fl3729_init(uint8_t index) {
 
     // Wait 10ms to ensure the device has woken up.
     wait_ms(10);
+
+    // The PWM registers may not match the buffer, so resend all of them on the next update.
+    pwm_dirty_mark_all(driver_buffers[index].pwm_dirty, sizeof(driver_buffers[index].pwm_dirty));
+    driver_buffers[index].pwm_buffer_dirty = true;
 }
 
 void is31fl3729_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
@@ -168,6 +184,9 @@ void is31fl3729_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
         driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        pwm_dirty_mark(driver_buffers[led.driver].pwm_dirty, led.r);
+        pwm_dirty_mark(driver_buffers[led.driver].pwm_dirty, led.g);
+        pwm_dirty_mark(driver_buffers[led.driver].pwm_dirty, led.b);
     }
 }
 
@@ -196,9 +215,9 @@ void is31fl3729_set_scaling_register(uint8_t index, uint8_t red, uint8_t green,
 
 void is31fl3729_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3729_write_pwm_buffer(index);
-
         driver_buffers[index].pwm_buffer_dirty = false;
+
+        is31fl3729_write_pwm_buffer(index);
     }
 }
 
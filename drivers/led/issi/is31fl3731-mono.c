@@ -21,6 +21,7 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "../pwm_dirty.h"
 
 #define IS31FL3731_PWM_REGISTER_COUNT 144
 #define IS31FL3731_LED_CONTROL_REGISTER_COUNT 18
@@ -49,10 +50,11 @@ const uint8_t i2c_addresses[IS31FL3731_DRIVER_COUNT] = {
 // These buffers match the IS31FL3731 PWM registers 0x24-0xB3.
 // Storing them like this is optimal for I2C transfers to the registers.
 // We could optimize this and take out the unused registers from these
-// buffers and the transfers in is31fl3731_write_pwm_buffer() but it's
-// probably not worth the extra complexity.
+// buffers, but it's probably not worth the extra complexity. Unused
+// registers are never marked in pwm_dirty, so they are not transferred.
 typedef struct is31fl3731_driver_t {
     uint8_t pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
+    uint8_t pwm_dirty[PWM_DIRTY_SIZE(IS31FL3731_PWM_REGISTER_COUNT)];
     bool    pwm_buffer_dirty;
     uint8_t led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
@@ -60,6 +62,7 @@ typedef struct is31fl3731_driver_t {
 
 is31fl3731_driver_t driver_buffers[IS31FL3731_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
+    .pwm_dirty                = {0},
     .pwm_buffer_dirty         = false,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
@@ -81,17 +84,26 @@ void is31fl3731_select_page(uint8_t index, uint8_t page) {
 
 void is31fl3731_write_pwm_buffer(uint8_t index) {
     // Assumes page 0 is already selected.
-    // Transmit PWM registers in 9 transfers of 16 bytes.
+    // Transmit runs of dirty PWM registers in transfers of up to 16 bytes.
+    uint8_t i = 0;
+    uint8_t length;
 
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
+    while ((length = pwm_dirty_next_run(driver_buffers[index].pwm_dirty, IS31FL3731_PWM_REGISTER_COUNT, &i, 16)) > 0) {
 #if IS31FL3731_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3731_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+        bool sent = false;
+        for (uint8_t j = 0; j < IS31FL3731_I2C_PERSISTENCE && !sent; j++) {
+            sent = i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT);
+        bool sent = i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS;
 #endif
+        if (sent) {
+            pwm_dirty_clear_run(driver_buffers[index].pwm_dirty, i, length);
+        } else {
+            // Leave the run marked and the buffer dirty, so the next update retries it.
+            driver_buffers[index].pwm_buffer_dirty = true;
+        }
+        i += length;
     }
 }
 
@@ -166,6 +178,10 @@ void is31fl3731_init(uint8_t index) {
     // most usage after initialization is just writing PWM buffers in page 0
     // as there's not much point in double-buffering
     is31fl3731_select_page(index, IS31FL3731_COMMAND_FRAME_1);
+
+    // The PWM registers may not match the buffer, so resend all of them on the next update.
+    pwm_dirty_mark_all(driver_buffers[index].pwm_dirty, sizeof(driver_buffers[index].pwm_dirty));
+    driver_buffers[index].pwm_buffer_dirty = true;
 }
 
 void is31fl3731_set_value(int index, uint8_t value) {
@@ -180,6 +196,7 @@ void is31fl3731_set_value(int index, uint8_t value) {
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
         driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        pwm_dirty_mark(driver_buffers[led.driver].pwm_dirty, led.v);
     }
 }
 
@@ -207,9 +224,9 @@ void is31fl3731_set_led_control_register(uint8_t index, bool value) {
 
 void is31fl3731_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3731_write_pwm_buffer(index);
-
         driver_buffers[index].pwm_buffer_dirty = false;
+
+        is31fl3731_write_pwm_buffer(index);
     }
 }
 
@@ -21,6 +21,7 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "../pwm_dirty.h"
 
 #define IS31FL3741_PWM_0_REGISTER_COUNT 180
 #define IS31FL3741_PWM_1_REGISTER_COUNT 171
@@ -72,11 +73,13 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 // The scaling buffers match the page 2 and 3 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 // We could optimize this and take out the unused registers from these
-// buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
-// probably not worth the extra complexity.
+// buffers, but it's probably not worth the extra complexity. Unused
+// registers are never marked in pwm_dirty, so they are not transferred.
 typedef struct is31fl3741_driver_t {
     uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
     uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
+    uint8_t pwm_dirty_0[PWM_DIRTY_SIZE(IS31FL3741_PWM_0_REGISTER_COUNT)];
+    uint8_t pwm_dirty_1[PWM_DIRTY_SIZE(IS31FL3741_PWM_1_REGISTER_COUNT)];
     bool    pwm_buffer_dirty;
     uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
     uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
@@ -86,6 +89,8 @@ typedef struct is31fl3741_driver_t {
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
+    .pwm_dirty_0          = {0},
+    .pwm_dirty_1          = {0},
     .pwm_buffer_dirty     = false,
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
@@ -107,36 +112,42 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
     is31fl3741_write_register(index, IS31FL3741_REG_COMMAND, page);
 }
 
-void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+static void is31fl3741_write_pwm_page(uint8_t index, uint8_t page, uint8_t *buffer, uint8_t *dirty, uint8_t count, uint8_t max_length) {
+    uint8_t i        = 0;
+    bool    selected = false;
+    uint8_t length;
 
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
+    while ((length = pwm_dirty_next_run(dirty, count, &i, max_length)) > 0) {
+        // Only switch pages if this one has anything to send.
+        if (!selected) {
+            is31fl3741_select_page(index, page);
+            selected = true;
+        }
 
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+        bool sent = false;
+        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE && !sent; j++) {
+            sent = i2c_write_register(i2c_addresses[index] << 1, i, buffer + i, length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
+        bool sent = i2c_write_register(i2c_addresses[index] << 1, i, buffer + i, length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS;
 #endif
+        if (sent) {
+            pwm_dirty_clear_run(dirty, i, length);
+        } else {
+            // Leave the run marked and the buffer dirty, so the next update retries it.
+            driver_buffers[index].pwm_buffer_dirty = true;
+        }
+        i += length;
     }
+}
 
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
-
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
+void is31fl3741_write_pwm_buffer(uint8_t index) {
+    // Transmit runs of dirty PWM0 registers in transfers of up to 30 bytes.
+    is31fl3741_write_pwm_page(index, IS31FL3741_COMMAND_PWM_0, driver_buffers[index].pwm_buffer_0, driver_buffers[index].pwm_dirty_0, IS31FL3741_PWM_0_REGISTER_COUNT, 30);
 
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
-#if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
-#endif
-    }
+    // Transmit runs of dirty PWM1 registers in transfers of up to 19 bytes.
+    is31fl3741_write_pwm_page(index, IS31FL3741_COMMAND_PWM_1, driver_buffers[index].pwm_buffer_1, driver_buffers[index].pwm_dirty_1, IS31FL3741_PWM_1_REGISTER_COUNT, 19);
 }
 
 void is31fl3741_init_drivers(void) {
@@ -183,6 +194,11 @@ void is31fl3741_init(uint8_t index) {
 
     // Wait 10ms to ensure the device has woken up.
     wait_ms(10);
+
+    // The PWM registers may not match the buffers, so resend all of them on the next update.
+    pwm_dirty_mark_all(driver_buffers[index].pwm_dirty_0, sizeof(driver_buffers[index].pwm_dirty_0));
+    pwm_dirty_mark_all(driver_buffers[index].pwm_dirty_1, sizeof(driver_buffers[index].pwm_dirty_1));
+    driver_buffers[index].pwm_buffer_dirty = true;
 }
 
 uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
@@ -196,8 +212,10 @@ uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
 void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
     if (reg & 0x100) {
         driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
+        pwm_dirty_mark(driver_buffers[driver].pwm_dirty_1, reg & 0xFF);
     } else {
         driver_buffers[driver].pwm_buffer_0[reg] = value;
+        pwm_dirty_mark(driver_buffers[driver].pwm_dirty_0, reg);
     }
 }
 
@@ -241,9 +259,9 @@ void is31fl3741_set_led_control_register(uint8_t index, bool value) {
 
 void is31fl3741_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3741_write_pwm_buffer(index);
-
         driver_buffers[index].pwm_buffer_dirty = false;
+
+        is31fl3741_write_pwm_buffer(index);
     }
 }
 
@@ -0,0 +1,93 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * Per-register dirty tracking for LED driver PWM buffers.
+ *
+ * The drivers mirror the chip's PWM registers in RAM. Rather than rewriting the
+ * whole buffer whenever anything changed, each register written since the last
+ * flush is marked in a bitmap, and the flush only sends runs of marked registers.
+ *
+ * Usage:
+ *
+ *     uint8_t pwm_dirty[PWM_DIRTY_SIZE(PWM_REGISTER_COUNT)];
+ *
+ *     pwm_dirty_mark(pwm_dirty, reg);
+ *
+ *     uint8_t i = 0, length;
+ *     while ((length = pwm_dirty_next_run(pwm_dirty, PWM_REGISTER_COUNT, &i, 16)) > 0) {
+ *         if (i2c_write_register(address, i, pwm_buffer + i, length, timeout) == I2C_STATUS_SUCCESS) {
+ *             pwm_dirty_clear_run(pwm_dirty, i, length);
+ *         }
+ *         i += length;
+ *     }
+ *
+ * A run whose transfer failed stays marked, so it is sent again by the next flush.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// Runs separated by up to this many clean registers are merged into one transfer,
+// as resending a couple of unchanged bytes is cheaper than another address and register header.
+#ifndef PWM_DIRTY_MAX_GAP
+#    define PWM_DIRTY_MAX_GAP 2
+#endif
+
+#define PWM_DIRTY_SIZE(count) (((count) + 7) / 8)
+
+static inline void pwm_dirty_mark(uint8_t *dirty, uint8_t reg) {
+    dirty[reg / 8] |= (1 << (reg % 8));
+}
+
+static inline void pwm_dirty_mark_all(uint8_t *dirty, uint8_t size) {
+    memset(dirty, 0xFF, size);
+}
+
+static inline bool pwm_dirty_is_marked(const uint8_t *dirty, uint8_t reg) {
+    return dirty[reg / 8] & (1 << (reg % 8));
+}
+
+/**
+ * Finds the next run of dirty registers at or after `*start`. The marks are left
+ * set until the run has been sent, see pwm_dirty_clear_run().
+ *
+ * On return `*start` is the first register of the run, which is at most `max_length`
+ * registers long and starts and ends on a dirty register. Returns the length of the
+ * run, or 0 once no dirty registers are left.
+ */
+static inline uint8_t pwm_dirty_next_run(uint8_t *dirty, uint8_t count, uint8_t *start, uint8_t max_length) {
+    uint16_t first = *start;
+
+    while (first < count && !pwm_dirty_is_marked(dirty, first)) {
+        // Skip clean bytes of the bitmap eight registers at a time
+        first = dirty[first / 8] == 0 ? (first | 7) + 1 : first + 1;
+    }
+    if (first >= count) {
+        return 0;
+    }
+
+    uint16_t end = first;
+    for (uint16_t reg = first; reg < count && reg - first < max_length; reg++) {
+        if (pwm_dirty_is_marked(dirty, reg)) {
+            end = reg + 1;
+        } else if (reg - end >= PWM_DIRTY_MAX_GAP) {
+            break;
+        }
+    }
+
+    *start = first;
+    return end - first;
+}
+
+/**
+ * Clears the marks of a run returned by pwm_dirty_next_run(), once it has been sent.
+ */
+static inline void pwm_dirty_clear_run(uint8_t *dirty, uint8_t start, uint8_t length) {
+    for (uint16_t reg = start; reg < (uint16_t)start + length; reg++) {
+        dirty[reg / 8] &= ~(1 << (reg % 8));
+    }
+}
@@ -0,0 +1,34 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "i2c_master.h"
+#include "i2c_mock.h"
+
+uint32_t i2c_mock_transactions = 0;
+uint32_t i2c_mock_bytes        = 0;
+uint8_t  i2c_mock_registers[256];
+uint8_t  i2c_mock_failures = 0;
+
+void i2c_mock_reset(void) {
+    i2c_mock_transactions = 0;
+    i2c_mock_bytes        = 0;
+    i2c_mock_failures     = 0;
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    if (regaddr + length > sizeof(i2c_mock_registers)) {
+        return I2C_STATUS_ERROR;
+    }
+    if (i2c_mock_failures > 0) {
+        i2c_mock_failures--;
+        return I2C_STATUS_TIMEOUT;
+    }
+
+    memcpy(&i2c_mock_registers[regaddr], data, length);
+    i2c_mock_transactions++;
+    i2c_mock_bytes += 2 + length;
+    return I2C_STATUS_SUCCESS;
+}
@@ -0,0 +1,19 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// Bus traffic since the last i2c_mock_reset(). Each register write costs the
+// address and register bytes on top of its data.
+extern uint32_t i2c_mock_transactions;
+extern uint32_t i2c_mock_bytes;
+
+// Number of upcoming register writes to fail, as a device that does not acknowledge would.
+extern uint8_t i2c_mock_failures;
+
+// Last value written to each register, regardless of page.
+extern uint8_t i2c_mock_registers[256];
+
+void i2c_mock_reset(void);
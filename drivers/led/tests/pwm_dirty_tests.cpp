@@ -0,0 +1,179 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <stdio.h>
+
+extern "C" {
+#include "is31fl3731.h"
+#include "pwm_dirty.h"
+#include "led/tests/i2c_mock.h"
+}
+
+#define PWM_REGISTER_COUNT 144
+// What the drivers used to send for any change: every register, in 16 byte transfers.
+#define FULL_REWRITE_BYTES ((PWM_REGISTER_COUNT / 16) * (2 + 16))
+
+// LED i drives PWM registers 3i, 3i + 1 and 3i + 2.
+#define LED(i) {0, (3 * (i)), (3 * (i)) + 1, (3 * (i)) + 2}
+
+const is31fl3731_led_t PROGMEM g_is31fl3731_leds[IS31FL3731_LED_COUNT] = {
+    LED(0),  LED(1),  LED(2),  LED(3),  LED(4),  LED(5),  LED(6),  LED(7),  LED(8),  LED(9),  LED(10), LED(11), LED(12), LED(13), LED(14), LED(15),
+    LED(16), LED(17), LED(18), LED(19), LED(20), LED(21), LED(22), LED(23), LED(24), LED(25), LED(26), LED(27), LED(28), LED(29), LED(30), LED(31),
+    LED(32), LED(33), LED(34), LED(35), LED(36), LED(37), LED(38), LED(39), LED(40), LED(41), LED(42), LED(43), LED(44), LED(45), LED(46), LED(47),
+};
+
+class PwmDirty : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        is31fl3731_init_drivers();
+        is31fl3731_set_color_all(0, 0, 0);
+        is31fl3731_flush();
+        i2c_mock_reset();
+    }
+
+    void ExpectLed(int index, uint8_t red, uint8_t green, uint8_t blue) {
+        EXPECT_EQ(i2c_mock_registers[IS31FL3731_FRAME_REG_PWM + 3 * index], red);
+        EXPECT_EQ(i2c_mock_registers[IS31FL3731_FRAME_REG_PWM + 3 * index + 1], green);
+        EXPECT_EQ(i2c_mock_registers[IS31FL3731_FRAME_REG_PWM + 3 * index + 2], blue);
+    }
+};
+
+TEST_F(PwmDirty, NoChangesSendNothing) {
+    is31fl3731_set_color(3, 0, 0, 0);
+    is31fl3731_flush();
+
+    EXPECT_EQ(i2c_mock_transactions, 0);
+}
+
+TEST_F(PwmDirty, FullFrameSendsEveryRegister) {
+    is31fl3731_set_color_all(10, 20, 30);
+    is31fl3731_flush();
+
+    EXPECT_EQ(i2c_mock_transactions, PWM_REGISTER_COUNT / 16);
+    EXPECT_EQ(i2c_mock_bytes, FULL_REWRITE_BYTES);
+    for (int i = 0; i < IS31FL3731_LED_COUNT; i++) {
+        ExpectLed(i, 10, 20, 30);
+    }
+}
+
+TEST_F(PwmDirty, SingleLedSendsOnlyItsRegisters) {
+    is31fl3731_set_color(20, 1, 2, 3);
+    is31fl3731_flush();
+
+    EXPECT_EQ(i2c_mock_transactions, 1);
+    EXPECT_EQ(i2c_mock_bytes, 2 + 3);
+    ExpectLed(20, 1, 2, 3);
+    ExpectLed(19, 0, 0, 0);
+    ExpectLed(21, 0, 0, 0);
+
+    /* Sent registers are clean again. */
+    i2c_mock_reset();
+    is31fl3731_flush();
+    EXPECT_EQ(i2c_mock_transactions, 0);
+}
+
+TEST_F(PwmDirty, DistantLedsAreSentSeparately) {
+    is31fl3731_set_color(0, 1, 1, 1);
+    is31fl3731_set_color(2, 2, 2, 2);
+    is31fl3731_set_color(47, 3, 3, 3);
+    is31fl3731_flush();
+
+    /* A gap of three clean registers is not worth resending. */
+    EXPECT_EQ(i2c_mock_transactions, 3);
+    EXPECT_EQ(i2c_mock_bytes, 3 * (2 + 3));
+    ExpectLed(0, 1, 1, 1);
+    ExpectLed(2, 2, 2, 2);
+    ExpectLed(47, 3, 3, 3);
+}
+
+TEST_F(PwmDirty, InitResendsEveryRegister) {
+    is31fl3731_set_color(5, 50, 60, 70);
+    is31fl3731_flush();
+
+    /* Re-initialising clears the chip, so the buffer must be sent in full. */
+    is31fl3731_init(0);
+    i2c_mock_reset();
+    is31fl3731_flush();
+
+    EXPECT_EQ(i2c_mock_bytes, FULL_REWRITE_BYTES);
+    ExpectLed(5, 50, 60, 70);
+}
+
+TEST_F(PwmDirty, FailedRunIsResent) {
+    is31fl3731_set_color(0, 1, 1, 1);
+    is31fl3731_set_color(47, 3, 3, 3);
+    i2c_mock_failures = 1;
+    is31fl3731_flush();
+
+    /* Only the run that went through is clean. */
+    EXPECT_EQ(i2c_mock_transactions, 1);
+    ExpectLed(0, 0, 0, 0);
+    ExpectLed(47, 3, 3, 3);
+
+    i2c_mock_reset();
+    is31fl3731_flush();
+    EXPECT_EQ(i2c_mock_transactions, 1);
+    EXPECT_EQ(i2c_mock_bytes, 2 + 3);
+    ExpectLed(0, 1, 1, 1);
+
+    i2c_mock_reset();
+    is31fl3731_flush();
+    EXPECT_EQ(i2c_mock_transactions, 0);
+}
+
+TEST_F(PwmDirty, RunsMergeSmallGaps) {
+    uint8_t dirty[PWM_DIRTY_SIZE(PWM_REGISTER_COUNT)] = {0};
+    uint8_t start                                     = 0;
+
+    pwm_dirty_mark(dirty, 10);
+    pwm_dirty_mark(dirty, 10 + 1 + PWM_DIRTY_MAX_GAP);
+    pwm_dirty_mark(dirty, 10 + 1 + PWM_DIRTY_MAX_GAP + 2 + PWM_DIRTY_MAX_GAP);
+
+    EXPECT_EQ(pwm_dirty_next_run(dirty, PWM_REGISTER_COUNT, &start, 16), 2 + PWM_DIRTY_MAX_GAP);
+    EXPECT_EQ(start, 10);
+
+    start += 2 + PWM_DIRTY_MAX_GAP;
+    EXPECT_EQ(pwm_dirty_next_run(dirty, PWM_REGISTER_COUNT, &start, 16), 1);
+    EXPECT_EQ(start, 10 + 1 + PWM_DIRTY_MAX_GAP + 2 + PWM_DIRTY_MAX_GAP);
+
+    start += 1;
+    EXPECT_EQ(pwm_dirty_next_run(dirty, PWM_REGISTER_COUNT, &start, 16), 0);
+}
+
+TEST_F(PwmDirty, RunsAreSplitAtMaxLength) {
+    uint8_t dirty[PWM_DIRTY_SIZE(PWM_REGISTER_COUNT)] = {0};
+    uint8_t start                                     = 0;
+    uint8_t length;
+    uint8_t lengths[4] = {0};
+    uint8_t runs       = 0;
+
+    for (uint8_t i = 100; i < 140; i++) {
+        pwm_dirty_mark(dirty, i);
+    }
+    while ((length = pwm_dirty_next_run(dirty, PWM_REGISTER_COUNT, &start, 16)) > 0 && runs < 4) {
+        lengths[runs++] = length;
+        start += length;
+    }
+
+    EXPECT_EQ(runs, 3);
+    EXPECT_EQ(lengths[0], 16);
+    EXPECT_EQ(lengths[1], 16);
+    EXPECT_EQ(lengths[2], 8);
+    EXPECT_EQ(start, 140);
+}
+
+// Bus traffic for a reactive effect frame where a handful of LEDs change, printed for comparison between builds
+TEST_F(PwmDirty, TypingFrameTraffic) {
+    const int leds[] = {4, 5, 17, 30, 31, 44};
+
+    for (uint8_t frame = 1; frame <= 10; frame++) {
+        for (int led : leds) {
+            is31fl3731_set_color(led, frame, frame, frame);
+        }
+        is31fl3731_flush();
+    }
+
+    printf("is31fl3731 typing frame: %.1f bytes on the bus, %u bytes for a full rewrite\n", i2c_mock_bytes / 10.0, (unsigned)FULL_REWRITE_BYTES);
+    EXPECT_LT(i2c_mock_bytes, 10 * FULL_REWRITE_BYTES);
+}
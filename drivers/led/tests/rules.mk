@@ -0,0 +1,8 @@
+led_pwm_dirty_DEFS := -DIS31FL3731_I2C_ADDRESS_1=0x74 -DIS31FL3731_LED_COUNT=48
+led_pwm_dirty_INC := $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
+
+led_pwm_dirty_SRC := \
+	$(DRIVER_PATH)/led/tests/i2c_mock.c \
+	$(DRIVER_PATH)/led/tests/pwm_dirty_tests.cpp \
+	$(DRIVER_PATH)/led/issi/is31fl3731.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
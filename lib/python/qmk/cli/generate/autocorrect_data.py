@@ -43,6 +43,12 @@ KC_A = 4
 KC_SPC = 0x2c
 KC_QUOT = 0x34
 
+# Version of the external flash format, see quantum/process_keycode/process_autocorrect.c
+EXTERNAL_VERSION = 2
+
+# AUTOCORRECT_MAX_CORRECTION_LENGTH unless the keymap changes it
+EXTERNAL_MAX_CORRECTION_DEFAULT = 32
+
 TYPO_CHARS = dict([
     ("'", KC_QUOT),
     (':', KC_SPC),  # "Word break" character.
@@ -165,11 +171,12 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
+def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any], link_size: int = 2) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
+    link_size: Number of bytes used to encode the link to a child node.
   Returns:
     List of ints in the range 0-255.
   """
@@ -220,25 +227,52 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
         else:  # Handle a branch table entry.
             data = []
             for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
+                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link, link_size)
             return data + [0]
 
     byte_offset = 0
     for e in table:  # To encode links, first compute byte offset of each entry.
         e['byte_offset'] = byte_offset
         byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
 
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
-def encode_link(link: Dict[str, Any]) -> List[int]:
-    """Encodes a node link as two bytes."""
+def encode_link(link: Dict[str, Any], link_size: int = 2) -> List[int]:
+    """Encodes a node link as `link_size` little endian bytes."""
     byte_offset = link['byte_offset']
-    if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+    if not (0 <= byte_offset < 1 << (8 * link_size)):
+        if link_size == 2:
+            cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries, or use --external.')
+        else:
+            cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 16MB limit.')
+        maybe_exit(1)
+    return [(byte_offset >> (8 * i)) & 255 for i in range(link_size)]
+
+
+def serialize_external(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> bytes:
+    """Serializes the trie for external flash, with the header read by the C code.
+
+  16-bit links are used whenever the table fits in 64KB with 24-bit links, and
+  24-bit links otherwise.
+  """
+    link_size = 3
+    data = serialize_trie(autocorrections, trie, link_size)
+    if len(data) <= 0xffff:
+        link_size = 2
+        data = serialize_trie(autocorrections, trie, link_size)
+
+    min_typo = min(len(typo) for typo, _ in autocorrections)
+    max_typo = max(len(typo) for typo, _ in autocorrections)
+    max_correction = max(autocorrections, key=lambda e: len(e[1]))[1]
+    if len(max_correction) > 255:
+        cli.log.error('{fg_red}Error:{fg_reset} Correction exceeds 255 chars: "{fg_cyan}%s{fg_reset}"', max_correction)
         maybe_exit(1)
-    return [byte_offset & 255, byte_offset >> 8]
+    if len(max_correction) > EXTERNAL_MAX_CORRECTION_DEFAULT:
+        cli.log.warning('{fg_yellow}Warning:{fg_reset} The longest correction is %d chars, add "#define AUTOCORRECT_MAX_CORRECTION_LENGTH %d" to config.h: "{fg_cyan}%s{fg_reset}"', len(max_correction), len(max_correction), max_correction)
+
+    header = [ord('Q'), ord('A'), ord('C'), EXTERNAL_VERSION, link_size, min_typo, max_typo, len(max_correction)] + list(len(data).to_bytes(4, 'little'))
+    return bytes(header + data)
 
 
 def typo_len(e: Tuple[str, str]) -> int:
@@ -254,15 +288,31 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-e', '--external', arg_only=True, action='store_true', help="Generate an image to write to external flash, instead of a header")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
 
+    if cli.args.external:
+        if current_keyboard and current_keymap:
+            cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'autocorrect_data.bin'
+        if not cli.args.output or cli.args.output.name == '-':
+            cli.log.error('{fg_red}Error:{fg_reset} An output file is required with --external.')
+            return False
+
+        image = serialize_external(autocorrections, trie)
+        cli.args.output.parent.mkdir(parents=True, exist_ok=True)
+        cli.args.output.write_bytes(image)
+        if not cli.args.quiet:
+            cli.log.info('Wrote %d bytes to %s.', len(image), cli.args.output)
+        return
+
+    data = serialize_trie(autocorrections, trie)
+
     if current_keyboard and current_keymap:
         cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'autocorrect_data.h'
 
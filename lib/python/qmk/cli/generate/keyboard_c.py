@@ -60,12 +60,110 @@ def _gen_led_config(info_data, config_type):
     lines.append(f'  {{ {", ".join(pos)} }},')
     lines.append(f'  {{ {", ".join(flags)} }},')
     lines.append('};')
+    if config_type == 'rgb_matrix':
+        lines.extend(_gen_led_polar(info_data, config_type))
+        lines.extend(_gen_led_distance(info_data, config_type))
     lines.append('#endif')
     lines.append('')
 
     return lines
 
 
+def _c_div(a, b):
+    """Integer division truncating toward zero, as in C.
+    """
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def _int8(value):
+    return ((value + 128) & 0xFF) - 128
+
+
+def _atan2_8(dy, dx):
+    """Python port of lib8tion's atan2_8(), matching it bit for bit.
+    """
+    if dy == 0:
+        return 0 if dx >= 0 else 128
+
+    abs_y = abs(dy)
+    if dx >= 0:
+        a = _int8(32 - _c_div(32 * (dx - abs_y), dx + abs_y))
+    else:
+        a = _int8(96 - _c_div(32 * (dx + abs_y), abs_y - dx))
+
+    return (-a if dy < 0 else a) & 0xFF
+
+
+def _sqrt16(x):
+    """Python port of lib8tion's sqrt16(), matching it bit for bit.
+    """
+    x &= 0xFFFF
+    if x <= 1:
+        return x
+
+    low = 1
+    hi = 255 if x > 7904 else (x >> 5) + 8
+    while True:
+        mid = (low + hi) >> 1
+        if (mid * mid) & 0xFFFF > x:
+            hi = (mid - 1) & 0xFF
+        else:
+            if mid == 255:
+                return 255
+            low = mid + 1
+        if hi < low:
+            return low - 1
+
+
+def _gen_led_polar(info_data, config_type):
+    """Convert info.json content to g_led_polar, the per LED angle and distances from the matrix center
+    """
+    center_x, center_y = info_data[config_type].get('center_point', [112, 32])
+
+    polar = []
+    for led_data in info_data[config_type]['layout']:
+        dx = led_data.get('x', 0) - center_x
+        dy = led_data.get('y', 0) - center_y
+        dual_dx = center_x // 2 - _int8(abs(_int8(dx)))
+        polar.append(f'{{{_atan2_8(dy, dx)}, {_sqrt16(dx * dx + dy * dy)}, {_sqrt16(dual_dx * dual_dx + dy * dy)}}}')
+
+    if not polar:
+        return []
+
+    lines = []
+    lines.append('#ifdef RGB_MATRIX_LED_POLAR_TABLE')
+    lines.append(f'static const led_polar_t led_polar[{len(polar)}] PROGMEM = {{ {", ".join(polar)} }};')
+    lines.append('const led_polar_t *g_led_polar = led_polar;')
+    lines.append('#endif')
+
+    return lines
+
+
+def _gen_led_distance(info_data, config_type):
+    """Convert info.json content to g_led_distance, the distance between every pair of LEDs
+    """
+    points = [(led_data.get('x', 0), led_data.get('y', 0)) for led_data in info_data[config_type]['layout']]
+
+    distance = []
+    for hi in range(1, len(points)):
+        for lo in range(hi):
+            dx = points[hi][0] - points[lo][0]
+            dy = points[hi][1] - points[lo][1]
+            distance.append(str(_sqrt16(dx * dx + dy * dy)))
+
+    if not distance:
+        return []
+
+    lines = []
+    lines.append('#ifdef RGB_MATRIX_LED_DISTANCE_TABLE')
+    lines.append(f'static const uint8_t led_distance[{len(distance)}] PROGMEM = {{ {", ".join(distance)} }};')
+    lines.append('const uint8_t *g_led_distance = led_distance;')
+    lines.append('#endif')
+
+    return lines
+
+
 def _gen_matrix_mask(info_data):
     """Convert info.json content to matrix_mask
     """
@@ -0,0 +1,195 @@
+"""Generate leader_data.h from a leader sequence dictionary.
+
+Each line of the dictionary file defines one leader sequence and its action with
+the syntax "keycodes -> action". Blank lines or lines starting with '#' are
+ignored. The action is either a keycode to tap, or a string to send, which may
+use the SS_ macros of send_string.
+
+Example:
+
+  KC_F             -> "QMK is awesome."
+  KC_D KC_D        -> SS_LCTL("a") SS_LCTL("c")
+  KC_D KC_D KC_S   -> "https://start.duckduckgo.com\\n"
+  KC_A KC_S        -> LGUI(KC_S)
+
+The sequences are compiled into a trie, which the firmware walks as each key of
+the sequence is typed.
+"""
+import textwrap
+from typing import Any, Dict, List, Tuple
+
+from milc import cli
+
+from qmk.commands import dump_lines
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.keyboard import keyboard_completer, keyboard_folder
+from qmk.keymap import keymap_completer, locate_keymap
+from qmk.path import normpath
+from qmk.util import maybe_exit
+
+# Size of leader_sequence[] in quantum/leader.c
+LEADER_MAX_LENGTH = 5
+
+# Flag set in the node header when the node has an action
+NODE_ACTION = 0x8000
+
+
+def parse_file(file_name: str) -> List[Tuple[Tuple[str, ...], str]]:
+    """Parses the leader dictionary file.
+
+    Args:
+        file_name: String, path of the leader dictionary.
+
+    Returns:
+        List of (sequence, action) tuples, where the sequence is a tuple of keycode names.
+    """
+    entries = []
+    sequences = set()
+    line_number = 0
+    for line in open(file_name, 'rt'):
+        line_number += 1
+        line = line.strip()
+        if not line or line[0] == '#':
+            continue
+
+        tokens = [token.strip() for token in line.split('->', 1)]
+        if len(tokens) != 2 or not tokens[0] or not tokens[1]:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Invalid syntax: "{fg_cyan}%s{fg_reset}"', line_number, line)
+            maybe_exit(1)
+            continue
+
+        sequence = tuple(tokens[0].split())
+        if len(sequence) > LEADER_MAX_LENGTH:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Sequence is longer than %d keys: "{fg_cyan}%s{fg_reset}"', line_number, LEADER_MAX_LENGTH, tokens[0])
+            maybe_exit(1)
+            continue
+        if sequence in sequences:
+            cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Ignoring duplicate sequence: "{fg_cyan}%s{fg_reset}"', line_number, tokens[0])
+            continue
+
+        entries.append((sequence, tokens[1]))
+        sequences.add(sequence)
+
+    return entries
+
+
+def make_trie(entries: List[Tuple[Tuple[str, ...], str]]) -> Dict[str, Any]:
+    """Makes a trie from the sequences.
+
+    Each node is a dict with the children keyed by keycode name, and the index of
+    its action under 'ACTION' when a sequence ends there.
+    """
+    trie = {}
+    for index, (sequence, _) in enumerate(entries):
+        node = trie
+        for keycode in sequence:
+            node = node.setdefault(keycode, {})
+        node['ACTION'] = index
+
+    return trie
+
+
+def serialize_trie(trie: Dict[str, Any]) -> List[str]:
+    """Serializes the trie into 16-bit words readable by the C code.
+
+    Each node is laid out as
+
+        [header] [action, if any] [keycode, child offset]...
+
+    where the header holds the number of children, and NODE_ACTION when the
+    node ends a sequence. Keycodes are kept as their C names.
+
+    Returns:
+        List of C expressions, one per word.
+    """
+    nodes = []
+
+    def collect(node):
+        entry = {'node': node, 'offset': 0}
+        nodes.append(entry)
+        entry['children'] = [(keycode, collect(child)) for keycode, child in node.items() if keycode != 'ACTION']
+        return entry
+
+    collect(trie)
+
+    offset = 0
+    for entry in nodes:
+        entry['offset'] = offset
+        offset += 1 + ('ACTION' in entry['node']) + 2 * len(entry['children'])
+    if offset > 0xFFFF:
+        cli.log.error('{fg_red}Error:{fg_reset} The leader table is too large, a node offset exceeds 64K words. Try reducing the dictionary to fewer entries.')
+        maybe_exit(1)
+
+    data = []
+    for entry in nodes:
+        header = len(entry['children'])
+        if 'ACTION' in entry['node']:
+            header |= NODE_ACTION
+        data.append(to_hex(header))
+        if 'ACTION' in entry['node']:
+            data.append(to_hex(entry['node']['ACTION']))
+        for keycode, child in entry['children']:
+            data += [keycode, to_hex(child['offset'])]
+
+    return data
+
+
+def action_statement(action: str) -> str:
+    """Returns the C statement which runs an action."""
+    if action.startswith('"') or action.startswith('SS_'):
+        return f'SEND_STRING({action});'
+    return f'tap_code16({action});'
+
+
+def to_hex(w: int) -> str:
+    return f'0x{w:04X}'
+
+
+@cli.argument('filename', type=normpath, help='The leader sequence dictionary file')
+@cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for. Ignored when a configurator export is supplied.')
+@cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.subcommand('Generate the leader sequence data file from a dictionary file.')
+def generate_leader_data(cli):
+    entries = parse_file(cli.args.filename)
+    if not entries:
+        cli.log.error('{fg_red}Error:{fg_reset} The dictionary does not contain any sequences.')
+        return False
+
+    data = serialize_trie(make_trie(entries))
+
+    current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_leader_data.keyboard
+    current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_leader_data.keymap
+
+    if current_keyboard and current_keymap:
+        cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'leader_data.h'
+
+    longest = max(len(' '.join(sequence)) for sequence, _ in entries)
+
+    leader_data_h_lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '']
+    leader_data_h_lines.append('#include "quantum.h"')
+    leader_data_h_lines.append('')
+
+    leader_data_h_lines.append(f'// Leader sequence dictionary ({len(entries)} entries):')
+    for sequence, action in entries:
+        leader_data_h_lines.append(f'//   {" ".join(sequence):<{longest}} -> {action}')
+
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append(f'#define LEADER_DATA_SIZE {len(data)}')
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append('static const uint16_t leader_data[LEADER_DATA_SIZE] PROGMEM = {')
+    leader_data_h_lines.append(textwrap.fill('    %s' % (', '.join(data)), width=100, subsequent_indent='    '))
+    leader_data_h_lines.append('};')
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append('static void leader_data_action(uint16_t action) {')
+    leader_data_h_lines.append('    switch (action) {')
+    for index, (_, action) in enumerate(entries):
+        leader_data_h_lines.append(f'        case {index}:')
+        leader_data_h_lines.append(f'            {action_statement(action)}')
+        leader_data_h_lines.append('            break;')
+    leader_data_h_lines.append('    }')
+    leader_data_h_lines.append('}')
+
+    # Show the results
+    dump_lines(cli.args.output, leader_data_h_lines, cli.args.quiet)
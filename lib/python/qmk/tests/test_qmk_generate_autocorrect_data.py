@@ -0,0 +1,25 @@
+from qmk.cli.generate.autocorrect_data import EXTERNAL_VERSION, make_trie, serialize_external
+
+
+def _external_image(autocorrections):
+    return serialize_external(autocorrections, make_trie(autocorrections))
+
+
+def test_external_header_records_lengths():
+    image = _external_image([('acheive', 'achieve'), ('accomodate', 'accommodate'), (':thier', 'their')])
+
+    assert image[:4] == bytes([ord('Q'), ord('A'), ord('C'), EXTERNAL_VERSION])
+    assert image[4] == 2  # link size
+    assert image[5] == len(':thier')
+    assert image[6] == len('accomodate')
+    assert image[7] == len('accommodate')
+    assert int.from_bytes(image[8:12], 'little') == len(image) - 12
+
+
+def test_external_rejects_corrections_the_header_cannot_hold():
+    try:
+        _external_image([('abcde', 'x' * 256)])
+    except SystemExit:
+        pass
+    else:
+        raise AssertionError('a 256 char correction was accepted')
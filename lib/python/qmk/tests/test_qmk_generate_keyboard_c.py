@@ -0,0 +1,83 @@
+import shutil
+import subprocess
+import tempfile
+import unittest
+from pathlib import Path
+
+from qmk.constants import QMK_FIRMWARE
+from qmk.cli.generate.keyboard_c import _atan2_8, _gen_led_config, _gen_led_distance, _int8, _sqrt16
+
+LIB8TION_HARNESS = r'''
+#include <stdio.h>
+#include "lib8tion/lib8tion.h"
+
+int main(int argc, char **argv) {
+    FILE *out = fopen(argv[1], "wb");
+    for (uint32_t x = 0; x <= 0xFFFF; x++) fputc(sqrt16(x), out);
+    for (int dy = -255; dy <= 255; dy++) {
+        for (int dx = -255; dx <= 255; dx++) fputc(atan2_8(dy, dx), out);
+    }
+    for (int v = -255; v <= 255; v++) fputc((uint8_t)abs8((int8_t)v), out);
+    return fclose(out);
+}
+'''
+
+
+def _lib8tion_results():
+    """Builds and runs LIB8TION_HARNESS with the host C compiler, returning its output.
+    """
+    compiler = shutil.which('cc') or shutil.which('gcc') or shutil.which('clang')
+    if not compiler:
+        raise unittest.SkipTest('no host C compiler to build lib8tion with')
+
+    with tempfile.TemporaryDirectory() as tmp:
+        source = Path(tmp) / 'lib8tion_harness.c'
+        binary = Path(tmp) / 'lib8tion_harness'
+        results = Path(tmp) / 'results.bin'
+        source.write_text(LIB8TION_HARNESS)
+        subprocess.run([compiler, f'-I{QMK_FIRMWARE / "lib"}', '-o', str(binary), str(source)], check=True)
+        subprocess.run([str(binary), str(results)], check=True)
+        return results.read_bytes()
+
+
+def test_led_geometry_matches_lib8tion():
+    results = _lib8tion_results()
+    values = range(-255, 256)
+
+    sqrt16 = results[:0x10000]
+    atan2_8 = results[0x10000:0x10000 + len(values) * len(values)]
+    abs8 = results[0x10000 + len(values) * len(values):]
+
+    assert [_sqrt16(x) for x in range(0x10000)] == list(sqrt16)
+    assert [_atan2_8(dy, dx) for dy in values for dx in values] == list(atan2_8)
+    assert [_int8(abs(_int8(v))) & 0xFF for v in values] == list(abs8)
+
+
+def test_gen_led_polar_is_guarded():
+    info_data = {
+        'matrix_size': {'cols': 2, 'rows': 1},
+        'rgb_matrix': {
+            'center_point': [112, 32],
+            'layout': [{'matrix': [0, 0], 'x': 112, 'y': 32, 'flags': 4}, {'matrix': [0, 1], 'x': 224, 'y': 0, 'flags': 4}],
+        },
+    }
+    lines = _gen_led_config(info_data, 'rgb_matrix')
+    polar = lines.index('#ifdef RGB_MATRIX_LED_POLAR_TABLE')
+
+    assert lines[polar + 1] == f'static const led_polar_t led_polar[2] PROGMEM = {{ {{0, 0, 56}}, {{{_atan2_8(-32, 112)}, {_sqrt16(112 * 112 + 32 * 32)}, {_sqrt16(56 * 56 + 32 * 32)}}} }};'
+    assert lines[polar + 2] == 'const led_polar_t *g_led_polar = led_polar;'
+    assert lines[polar + 3] == '#endif'
+
+
+def test_gen_led_distance_orders_pairs_by_higher_index():
+    corners = [{'x': 0, 'y': 0}, {'x': 224, 'y': 0}, {'x': 0, 'y': 64}, {'x': 224, 'y': 64}]
+    lines = _gen_led_distance({'rgb_matrix': {'layout': corners}}, 'rgb_matrix')
+
+    # Same table as tests/rgb_matrix_led_geometry feeds to rgb_matrix_led_distance()
+    assert lines == [
+        '#ifdef RGB_MATRIX_LED_DISTANCE_TABLE',
+        'static const uint8_t led_distance[6] PROGMEM = { 224, 64, 232, 232, 64, 224 };',
+        'const uint8_t *g_led_distance = led_distance;',
+        '#endif',
+    ]
+    assert _gen_led_distance({'rgb_matrix': {'layout': corners[:1]}}, 'rgb_matrix') == []
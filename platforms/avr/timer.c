@@ -125,6 +125,25 @@ inline uint32_t timer_read32(void) {
     return t;
 }
 
+/** \brief Microsecond resolution stamp
+ *
+ * Combines the millisecond count with timer0's progress through the current millisecond,
+ * retrying if the compare interrupt fired in between.
+ */
+uint32_t timer_read_stamp(void) {
+    uint32_t ms;
+    uint8_t  raw;
+    do {
+        ms  = timer_read32();
+        raw = TIMER_RAW;
+    } while (ms != timer_read32());
+    return ms * 1000 + (uint32_t)raw * 1000 / (TIMER_RAW_TOP + 1);
+}
+
+uint32_t timer_stamp_diff_us(uint32_t end, uint32_t start) {
+    return TIMER_DIFF_32(end, start);
+}
+
 // excecuted once per 1ms.(excess for just timer count?)
 #ifndef __AVR_ATmega32A__
 #    define TIMER_INTERRUPT_VECTOR TIMER0_COMPA_vect
@@ -94,6 +94,27 @@ void timer_save(void) {
     platform_timer_save_value(timer_read32());
 }
 
+#if PORT_SUPPORTS_RT == TRUE
+// The realtime cycle counter, the system time only advances once per tick (10-100us)
+uint32_t timer_read_stamp(void) {
+    return (uint32_t)chSysGetRealtimeCounterX();
+}
+
+uint32_t timer_stamp_diff_us(uint32_t end, uint32_t start) {
+    rtcnt_t cycles = (rtcnt_t)(end - start);
+    return cycles == 0 ? 0 : (uint32_t)RTC2US(REALTIME_COUNTER_CLOCK, cycles);
+}
+#else
+// The raw system time, which may be narrower than 32 bits, so that chTimeDiffX() can deal with wraparound
+uint32_t timer_read_stamp(void) {
+    return (uint32_t)chVTGetSystemTimeX();
+}
+
+uint32_t timer_stamp_diff_us(uint32_t end, uint32_t start) {
+    return (uint32_t)TIME_I2US(chTimeDiffX((systime_t)start, (systime_t)end));
+}
+#endif
+
 uint16_t timer_read(void) {
     return (uint16_t)timer_read32();
 }
@@ -71,7 +71,10 @@ void     eeprom_update_block(const void *__src, void *__dst, size_t __n);
 #elif defined(EEPROM_TEST_HARNESS)
 #    ifndef LEGACY_FLASH_OPS_MOCKED
 // Normal tests
-#        define TOTAL_EEPROM_BYTE_COUNT 32
+#        ifndef TEST_EEPROM_BYTE_COUNT
+#            define TEST_EEPROM_BYTE_COUNT 32
+#        endif
+#        define TOTAL_EEPROM_BYTE_COUNT (TEST_EEPROM_BYTE_COUNT)
 #    else
 // Flash wear-leveling testing
 #        include "eeprom_legacy_emulated_flash_tests.h"
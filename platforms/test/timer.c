@@ -18,6 +18,7 @@
 #include <stdatomic.h>
 
 static atomic_uint_least32_t current_time      = 0;
+static atomic_uint_least32_t current_time_us   = 0; // sub-millisecond part of the simulated time
 static atomic_uint_least32_t async_tick_amount = 0;
 static atomic_uint_least32_t access_counter    = 0;
 
@@ -39,12 +40,14 @@ void reset_access_counter(void) {
 
 void timer_init(void) {
     current_time      = 0;
+    current_time_us   = 0;
     async_tick_amount = 0;
     access_counter    = 0;
 }
 
 void timer_clear(void) {
     current_time      = 0;
+    current_time_us   = 0;
     async_tick_amount = 0;
     access_counter    = 0;
 }
@@ -61,8 +64,9 @@ uint32_t timer_read32(void) {
 }
 
 void set_time(uint32_t t) {
-    current_time   = t;
-    access_counter = 0;
+    current_time    = t;
+    current_time_us = 0;
+    access_counter  = 0;
 }
 
 void advance_time(uint32_t ms) {
@@ -70,6 +74,26 @@ void advance_time(uint32_t ms) {
     access_counter = 0;
 }
 
+/** \brief Microsecond resolution view of the simulated time, used as the timer stamp. */
+uint32_t timer_read_us(void) {
+    return current_time * 1000 + current_time_us;
+}
+
+uint32_t timer_read_stamp(void) {
+    return timer_read_us();
+}
+
+uint32_t timer_stamp_diff_us(uint32_t end, uint32_t start) {
+    return TIMER_DIFF_32(end, start);
+}
+
+void advance_time_us(uint32_t us) {
+    uint32_t total  = current_time_us + us;
+    current_time_us = total % 1000;
+    current_time += total / 1000;
+    access_counter = 0;
+}
+
 void wait_ms(uint32_t ms) {
     advance_time(ms);
 }
@@ -14,3 +14,7 @@ uint16_t timer_elapsed(uint16_t last) {
 uint32_t timer_elapsed32(uint32_t last) {
     return TIMER_DIFF_32(timer_read32(), last);
 }
+
+uint32_t timer_stamp_elapsed_us(uint32_t start) {
+    return timer_stamp_diff_us(timer_read_stamp(), start);
+}
@@ -44,6 +44,13 @@ uint32_t timer_read32(void);
 uint16_t timer_elapsed(uint16_t last);
 uint32_t timer_elapsed32(uint32_t last);
 
+// Microsecond timing of short sections of code. Stamps are in platform specific units, only
+// meaningful to timer_stamp_diff_us(), which copes with the underlying timer wrapping around
+// as long as the interval is shorter than its period.
+uint32_t timer_read_stamp(void);
+uint32_t timer_stamp_diff_us(uint32_t end, uint32_t start);
+uint32_t timer_stamp_elapsed_us(uint32_t start);
+
 // Utility functions to check if a future time has expired & autmatically handle time wrapping if checked / reset frequently (half of max value)
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
 #define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
@@ -44,6 +44,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "encoder.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 int tp_buttons;
 
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
@@ -284,18 +288,27 @@ void process_record(keyrecord_t *record) {
 #ifdef FLOW_TAP_TERM
     flow_tap_update_last_event(record);
 #endif // FLOW_TAP_TERM
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_record_begin(record->event);
+#endif
 
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
         }
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+        latency_trace_record_end(record->event);
 #endif
         return;
     }
 
     process_record_handler(record);
     post_process_record_quantum(record);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_record_end(record->event);
+#endif
 }
 
 void process_record_handler(keyrecord_t *record) {
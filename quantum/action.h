@@ -62,6 +62,26 @@ void action_exec(keyevent_t event);
 action_t action_for_key(uint8_t layer, keypos_t key);
 action_t action_for_keycode(uint16_t keycode);
 
+#ifdef KEY_ACTION_CACHE
+/**
+ * @brief Marks the key action cache as stale, forcing every action to be looked up again on next use.
+ *
+ * Must be called whenever the keymap changes underneath QMK, e.g. from a custom `keymap_key_to_keycode()`.
+ */
+void key_action_cache_invalidate(void);
+
+/**
+ * @brief Drops the cached action of a single key after its keycode has changed.
+ *
+ * @param layer Layer that was written
+ * @param key Position of the key that was written
+ */
+void key_action_cache_invalidate_key(uint8_t layer, keypos_t key);
+#else
+#    define key_action_cache_invalidate()
+#    define key_action_cache_invalidate_key(layer, key)
+#endif
+
 /* keyboard-specific key event (pre)processing */
 bool process_record_quantum(keyrecord_t *record);
 
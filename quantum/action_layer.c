@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -335,6 +336,48 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
+#if defined(RESOLVED_LAYER_CACHE) && !defined(NO_ACTION_LAYER)
+/** \brief resolved layer cache
+ *
+ * For every key in the matrix, the set of layers on which that key is not transparent. Resolving
+ * the topmost layer for a key is then a mask against the active layers, with no keymap lookups,
+ * and the cache stays valid across layer state changes. Entries are filled lazily on first use.
+ */
+static layer_state_t resolved_layer_cache[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t       resolved_layer_cache_valid[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)] = {0};
+
+void resolved_layer_cache_invalidate(void) {
+    memset(resolved_layer_cache_valid, 0, sizeof(resolved_layer_cache_valid));
+}
+
+static layer_state_t resolved_layer_cache_get(keypos_t key) {
+    const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+    const uint16_t storage_idx  = entry_number / (CHAR_BIT);
+    const uint8_t  storage_bit  = 1U << (entry_number % (CHAR_BIT));
+
+    if (!(resolved_layer_cache_valid[storage_idx] & storage_bit)) {
+        layer_state_t opaque = 0;
+        for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+            if (action_for_key(layer, key).code != ACTION_TRANSPARENT) {
+                opaque |= (layer_state_t)1 << layer;
+            }
+        }
+        resolved_layer_cache[key.row][key.col] = opaque;
+        resolved_layer_cache_valid[storage_idx] |= storage_bit;
+    }
+    return resolved_layer_cache[key.row][key.col];
+}
+
+void resolved_layer_cache_invalidate_key(keypos_t key) {
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return;
+    }
+    // Rebuilt by the next lookup from action_for_key(), like any other entry
+    const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+    resolved_layer_cache_valid[entry_number / (CHAR_BIT)] &= ~(1U << (entry_number % (CHAR_BIT)));
+}
+#endif
+
 /** \brief Layer switch get layer
  *
  * Gets the layer based on key info
@@ -345,6 +388,13 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+#    ifdef RESOLVED_LAYER_CACHE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        layers &= resolved_layer_cache_get(key);
+        /* fall back to layer 0 */
+        return layers ? get_highest_layer(layers) : 0;
+    }
+#    endif
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
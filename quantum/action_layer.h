@@ -166,6 +166,25 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+#if defined(RESOLVED_LAYER_CACHE) && !defined(NO_ACTION_LAYER)
+/**
+ * @brief Marks the resolved layer cache as stale, forcing it to be rebuilt on next use.
+ *
+ * Must be called whenever the keymap changes underneath QMK, e.g. from a custom `keymap_key_to_keycode()`.
+ */
+void resolved_layer_cache_invalidate(void);
+
+/**
+ * @brief Drops the resolved layers of a single key after its keycode has changed on any layer.
+ *
+ * @param key Position of the key that was written
+ */
+void resolved_layer_cache_invalidate_key(keypos_t key);
+#else
+#    define resolved_layer_cache_invalidate()
+#    define resolved_layer_cache_invalidate_key(key)
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
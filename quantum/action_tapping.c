@@ -8,6 +8,7 @@
 #include "keycode.h"
 #include "quantum_keycodes.h"
 #include "timer.h"
+#include "deadline.h"
 
 #ifndef NO_ACTION_TAPPING
 
@@ -169,6 +170,44 @@ void action_tapping_process(keyrecord_t record) {
     }
 }
 
+bool action_tapping_is_idle(void) {
+    if (IS_EVENT(tapping_key.event) || waiting_buffer_head != waiting_buffer_tail) {
+        return false;
+    }
+#    if defined(CHORDAL_HOLD) || defined(FLOW_TAP_TERM)
+    // Tick events are matched against registered taps too
+    if (num_registered_taps != 0) {
+        return false;
+    }
+#    endif // defined(CHORDAL_HOLD) || defined(FLOW_TAP_TERM)
+#    ifdef FLOW_TAP_TERM
+    if (!flow_tap_expired) {
+        return false;
+    }
+#    endif // FLOW_TAP_TERM
+    return true;
+}
+
+bool action_tapping_next_deadline(uint32_t *deadline) {
+    bool pending = false;
+
+    if (IS_EVENT(tapping_key.event)) {
+        const uint16_t term    = GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key);
+        const bool     expired = TIMER_DIFF_16(timer_read(), tapping_key.event.time) >= term;
+        // A tapped key held past the tapping term only changes state on its release
+        if (!(expired && tapping_key.event.pressed && tapping_key.tap.count > 0)) {
+            deadline_merge(&pending, deadline, deadline_from_timer16(tapping_key.event.time + term));
+        }
+    }
+#    ifdef FLOW_TAP_TERM
+    if (!flow_tap_expired) {
+        deadline_merge(&pending, deadline, deadline_from_timer16(flow_tap_prev_time + INT16_MAX / 2));
+    }
+#    endif // FLOW_TAP_TERM
+
+    return pending;
+}
+
 /* Some conditionally defined helper macros to keep process_tapping more
  * readable. The conditional definition of tapping_keycode and all the
  * conditional uses of it are hidden inside macros named TAP_...
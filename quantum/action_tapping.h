@@ -38,6 +38,19 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache);
 uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache);
 void     action_tapping_process(keyrecord_t record);
+
+/** \brief Whether a tick event would leave the tapping state unchanged.
+ *
+ * \return true if there is no tapping key, nothing is waiting to be processed and no flow tap timer is running
+ */
+bool action_tapping_is_idle(void);
+
+/** \brief Retrieves the time at which a tick event may next change the tapping state.
+ *
+ * \param deadline[out] the deadline in the timer_read32() time-space, which may already have passed
+ * \return true if the tapping state machine is waiting for a timeout, otherwise false and deadline is left untouched
+ */
+bool action_tapping_next_deadline(uint32_t *deadline);
 #endif
 
 uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record);
@@ -20,6 +20,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "action_util.h"
 #include "action_layer.h"
 #include "timer.h"
+#include "deadline.h"
 #include "keycode_config.h"
 #include <string.h>
 
@@ -253,6 +254,31 @@ bool is_oneshot_enabled(void) {
     return keymap_config.oneshot_enable;
 }
 
+/** \brief Retrieves the time at which the next oneshot timeout expires.
+ *
+ * Oneshot timeouts are evaluated by action_exec(), so this is the next time a tick event is needed for them.
+ */
+bool oneshot_next_deadline(uint32_t *deadline) {
+    bool pending = false;
+#    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
+    if (!keymap_config.oneshot_enable) {
+        return false;
+    }
+    if (oneshot_mods) {
+        deadline_merge(&pending, deadline, deadline_from_timer16(oneshot_time + ONESHOT_TIMEOUT));
+    }
+    if ((get_oneshot_layer_state() & ONESHOT_OTHER_KEY_PRESSED) && !(get_oneshot_layer_state() & ONESHOT_TOGGLED)) {
+        deadline_merge(&pending, deadline, deadline_from_timer16(oneshot_layer_time + ONESHOT_TIMEOUT));
+    }
+#        ifdef SWAP_HANDS_ENABLE
+    if (swap_hands_oneshot == SHO_ACTIVE) {
+        deadline_merge(&pending, deadline, deadline_from_timer16(oneshot_swaphands_time + ONESHOT_TIMEOUT));
+    }
+#        endif
+#    endif
+    return pending;
+}
+
 #endif
 
 static uint8_t get_mods_for_report(void) {
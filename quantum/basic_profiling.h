@@ -26,7 +26,9 @@
 #elif defined(PROTOCOL_CHIBIOS)
 #    define TIMESTAMP_GETTER chSysGetRealtimeCounterX()
 #else
-#    error Unknown protocol in use
+// Test platform, microseconds of simulated time
+uint32_t timer_read_us(void);
+#    define TIMESTAMP_GETTER timer_read_us()
 #endif
 
 #ifndef CONSOLE_ENABLE
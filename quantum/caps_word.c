@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include "caps_word.h"
 #include "timer.h"
+#include "deadline.h"
 #include "action.h"
 #include "action_util.h"
 
@@ -40,8 +41,20 @@ void caps_word_task(void) {
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
 }
+
+bool caps_word_next_deadline(uint32_t *deadline) {
+    if (!caps_word_active) {
+        return false;
+    }
+    *deadline = deadline_from_timer16(idle_timer);
+    return true;
+}
 #else
 void caps_word_task(void) {}
+
+bool caps_word_next_deadline(uint32_t *deadline) {
+    return false;
+}
 #endif // CAPS_WORD_IDLE_TIMEOUT > 0
 
 void caps_word_on(void) {
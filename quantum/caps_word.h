@@ -15,6 +15,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifndef CAPS_WORD_IDLE_TIMEOUT
 #    define CAPS_WORD_IDLE_TIMEOUT 5000 // Default timeout of 5 seconds.
@@ -23,6 +24,14 @@
 /** @brief Matrix scan task for Caps Word feature */
 void caps_word_task(void);
 
+/**
+ * @brief Retrieves the time at which Caps Word times out from being idle.
+ *
+ * @param deadline Receives the deadline in the timer_read32() time-space, which may already have passed
+ * @return True if Caps Word is active and has an idle timeout, false otherwise
+ */
+bool caps_word_next_deadline(uint32_t *deadline);
+
 #if CAPS_WORD_IDLE_TIMEOUT > 0
 /** @brief Resets timer for Caps Word idle timeout. */
 void caps_word_reset_idle_timer(void);
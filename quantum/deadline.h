@@ -0,0 +1,43 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "timer.h"
+
+/* Helpers for reporting the next time a subsystem needs to run.
+ *
+ * Deadlines are expressed in the timer_read32() time-space. A deadline may
+ * already be in the past, which means the subsystem has work to do right now.
+ * Reporting a deadline earlier than strictly necessary is always safe -- it
+ * only costs a wasted wakeup -- whereas reporting one too late delays timeouts.
+ */
+
+/** \brief Converts a deadline in the 16-bit timer_read() time-space into the timer_read32() time-space.
+ *
+ * The deadline must be within ±32 seconds of the current time.
+ */
+static inline uint32_t deadline_from_timer16(uint16_t deadline) {
+    uint32_t now = timer_read32();
+    return now + (int16_t)(uint16_t)(deadline - (uint16_t)now);
+}
+
+/** \brief Returns true if deadline `a` is due before deadline `b`. */
+static inline bool deadline_before(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) < 0;
+}
+
+/** \brief Merges `candidate` into the earliest deadline found so far.
+ *
+ * \param pending[in,out] whether `earliest` already holds a deadline
+ * \param earliest[in,out] the earliest deadline found so far
+ * \param candidate the deadline to merge in
+ */
+static inline void deadline_merge(bool *pending, uint32_t *earliest, uint32_t candidate) {
+    if (!*pending || deadline_before(candidate, *earliest)) {
+        *earliest = candidate;
+        *pending  = true;
+    }
+}
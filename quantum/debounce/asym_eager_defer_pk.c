@@ -21,6 +21,8 @@
 Asymetric per-key algorithm. After pressing a key, it immediately changes state,
 with no further inputs accepted until DEBOUNCE milliseconds have occurred. After
 releasing a key, that state is pushed after no changes occur for DEBOUNCE milliseconds.
+A key stays in active_keys for its whole key-down lockout, but leaves as soon as a
+pending key-up bounces back to its debounced state.
 */
 
 #include "debounce.h"
@@ -52,6 +54,7 @@ typedef struct {
 
 #if DEBOUNCE > 0
 static debounce_counter_t *debounce_counters;
+static matrix_row_t        active_keys[MATRIX_ROWS];
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                matrix_need_update;
@@ -70,6 +73,7 @@ void debounce_init(uint8_t num_rows) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
             debounce_counters[i++].time = DEBOUNCE_ELAPSED;
         }
+        active_keys[r] = 0;
     }
 }
 
@@ -109,67 +113,72 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     counters_need_update = false;
     matrix_need_update   = false;
 
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+        matrix_row_t        active           = active_keys[row];
+        for (uint8_t col = 0; active; col++) {
             matrix_row_t col_mask = (ROW_SHIFTER << col);
+            if (!(active & col_mask)) {
+                continue;
+            }
+            active &= ~col_mask;
+
+            if (debounce_pointer[col].time <= elapsed_time) {
+                debounce_pointer[col].time = DEBOUNCE_ELAPSED;
+                active_keys[row] &= ~col_mask;
 
-            if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (debounce_pointer->time <= elapsed_time) {
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
-
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        matrix_need_update = true;
-                    } else {
-                        // key-up: defer
-                        matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
-                        cooked_changed |= cooked_next ^ cooked[row];
-                        cooked[row] = cooked_next;
-                    }
+                if (debounce_pointer[col].pressed) {
+                    // key-down: eager
+                    matrix_need_update = true;
                 } else {
-                    debounce_pointer->time -= elapsed_time;
-                    counters_need_update = true;
+                    // key-up: defer
+                    matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
+                    cooked_changed |= cooked_next ^ cooked[row];
+                    cooked[row] = cooked_next;
                 }
+            } else {
+                debounce_pointer[col].time -= elapsed_time;
+                counters_need_update = true;
             }
-            debounce_pointer++;
         }
     }
 }
 
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     matrix_need_update = false;
 
     for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+        matrix_row_t        delta            = raw[row] ^ cooked[row];
+        matrix_row_t        started          = delta & ~active_keys[row];
+        matrix_row_t        settled          = active_keys[row] & ~delta;
+
+        for (uint8_t col = 0; started | settled; col++) {
             matrix_row_t col_mask = (ROW_SHIFTER << col);
 
-            if (delta & col_mask) {
-                if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
-                    debounce_pointer->pressed = (raw[row] & col_mask);
-                    debounce_pointer->time    = DEBOUNCE;
-                    counters_need_update      = true;
-
-                    if (debounce_pointer->pressed) {
-                        // key-down: eager
-                        cooked[row] ^= col_mask;
-                        cooked_changed = true;
-                    }
+            if (started & col_mask) {
+                started &= ~col_mask;
+                debounce_pointer[col].pressed = (raw[row] & col_mask);
+                debounce_pointer[col].time    = DEBOUNCE;
+                active_keys[row] |= col_mask;
+                counters_need_update = true;
+
+                if (debounce_pointer[col].pressed) {
+                    // key-down: eager
+                    cooked[row] ^= col_mask;
+                    cooked_changed = true;
                 }
-            } else if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (!debounce_pointer->pressed) {
+            } else if (settled & col_mask) {
+                settled &= ~col_mask;
+                if (!debounce_pointer[col].pressed) {
                     // key-up: defer
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
+                    debounce_pointer[col].time = DEBOUNCE_ELAPSED;
+                    active_keys[row] &= ~col_mask;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
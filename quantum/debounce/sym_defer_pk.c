@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 /*
 Basic symmetric per-key algorithm. Uses an 8-bit counter per key.
 When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+active_keys is exactly the set of keys whose raw state differs from the debounced one.
 */
 
 #include "debounce.h"
@@ -45,6 +46,7 @@ typedef uint8_t debounce_counter_t;
 
 #if DEBOUNCE > 0
 static debounce_counter_t *debounce_counters;
+static matrix_row_t        active_keys[MATRIX_ROWS];
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                cooked_changed;
@@ -62,6 +64,7 @@ void debounce_init(uint8_t num_rows) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
         }
+        active_keys[r] = 0;
     }
 }
 
@@ -101,41 +104,57 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    counters_need_update                 = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    counters_need_update = false;
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (*debounce_pointer != DEBOUNCE_ELAPSED) {
-                if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer        = DEBOUNCE_ELAPSED;
-                    matrix_row_t cooked_next = (cooked[row] & ~(ROW_SHIFTER << col)) | (raw[row] & (ROW_SHIFTER << col));
-                    cooked_changed |= cooked[row] ^ cooked_next;
-                    cooked[row] = cooked_next;
-                } else {
-                    *debounce_pointer -= elapsed_time;
-                    counters_need_update = true;
-                }
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+        matrix_row_t        expired          = 0;
+        matrix_row_t        active           = active_keys[row];
+        for (uint8_t col = 0; active; col++) {
+            matrix_row_t col_mask = ROW_SHIFTER << col;
+            if (!(active & col_mask)) {
+                continue;
+            }
+            active &= ~col_mask;
+
+            if (debounce_pointer[col] <= elapsed_time) {
+                debounce_pointer[col] = DEBOUNCE_ELAPSED;
+                expired |= col_mask;
+            } else {
+                debounce_pointer[col] -= elapsed_time;
+                counters_need_update = true;
             }
-            debounce_pointer++;
+        }
+
+        if (expired) {
+            active_keys[row] &= ~expired;
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
         }
     }
 }
 
 static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
     for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (delta & (ROW_SHIFTER << col)) {
-                if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
-                    counters_need_update = true;
-                }
-            } else {
-                *debounce_pointer = DEBOUNCE_ELAPSED;
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+        matrix_row_t        delta            = raw[row] ^ cooked[row];
+        matrix_row_t        stopped          = active_keys[row] & ~delta;
+        matrix_row_t        started          = delta & ~active_keys[row];
+
+        // Keys which went back to their debounced state stop debouncing, changed keys start if not already running
+        for (uint8_t col = 0; stopped | started; col++) {
+            matrix_row_t col_mask = ROW_SHIFTER << col;
+            if (stopped & col_mask) {
+                debounce_pointer[col] = DEBOUNCE_ELAPSED;
+                stopped &= ~col_mask;
+            } else if (started & col_mask) {
+                debounce_pointer[col] = DEBOUNCE;
+                started &= ~col_mask;
+                counters_need_update = true;
             }
-            debounce_pointer++;
         }
+
+        active_keys[row] = delta;
     }
 }
 
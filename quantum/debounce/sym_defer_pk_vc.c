@@ -0,0 +1,168 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key defer algorithm using vertical counters.
+
+Behaves exactly like sym_defer_pk, but instead of an 8-bit counter per key
+the counters are stored bit-sliced: plane `b` of a row holds bit `b` of the
+counter of every key in that row. Counters of a whole row are decremented
+with a ripple-borrow subtraction across the planes, so an update costs a
+few bitwise operations per plane and row rather than a loop over every key.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Number of bit planes needed to hold a counter value of DEBOUNCE
+#    if DEBOUNCE < 2
+#        define COUNTER_PLANES 1
+#    elif DEBOUNCE < 4
+#        define COUNTER_PLANES 2
+#    elif DEBOUNCE < 8
+#        define COUNTER_PLANES 3
+#    elif DEBOUNCE < 16
+#        define COUNTER_PLANES 4
+#    elif DEBOUNCE < 32
+#        define COUNTER_PLANES 5
+#    elif DEBOUNCE < 64
+#        define COUNTER_PLANES 6
+#    elif DEBOUNCE < 128
+#        define COUNTER_PLANES 7
+#    else
+#        define COUNTER_PLANES 8
+#    endif
+
+// A counter of zero means the key is not being debounced
+static matrix_row_t counter_planes[MATRIX_ROWS][COUNTER_PLANES];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        for (uint8_t plane = 0; plane < COUNTER_PLANES; plane++) {
+            counter_planes[row][plane] = 0;
+        }
+    }
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        // No counter can exceed DEBOUNCE, so anything larger expires them all
+        if (elapsed_time > DEBOUNCE) {
+            elapsed_time = DEBOUNCE;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *planes = counter_planes[row];
+        matrix_row_t  active = 0;
+        for (uint8_t plane = 0; plane < COUNTER_PLANES; plane++) {
+            active |= planes[plane];
+        }
+        if (!active) {
+            continue;
+        }
+
+        // counter -= elapsed_time, for every key of the row at once
+        matrix_row_t borrow    = 0;
+        matrix_row_t remaining = 0;
+        for (uint8_t plane = 0; plane < COUNTER_PLANES; plane++) {
+            matrix_row_t counter = planes[plane];
+            matrix_row_t elapsed = (elapsed_time >> plane) & 1 ? (matrix_row_t)~0 : 0;
+            matrix_row_t diff    = counter ^ elapsed ^ borrow;
+            borrow               = (~counter & (elapsed | borrow)) | (elapsed & borrow);
+            planes[plane]        = diff;
+            remaining |= diff;
+        }
+
+        // Counters which reached or went past zero have expired
+        matrix_row_t expired = active & (borrow | ~remaining);
+        matrix_row_t running = active & ~expired;
+        for (uint8_t plane = 0; plane < COUNTER_PLANES; plane++) {
+            planes[plane] &= running;
+        }
+
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+        if (running) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *planes = counter_planes[row];
+        matrix_row_t  delta  = raw[row] ^ cooked[row];
+        matrix_row_t  active = 0;
+        for (uint8_t plane = 0; plane < COUNTER_PLANES; plane++) {
+            // Keys which went back to their debounced state stop debouncing
+            planes[plane] &= delta;
+            active |= planes[plane];
+        }
+
+        // Keys which changed and are not already debouncing start at DEBOUNCE
+        matrix_row_t start = delta & ~active;
+        if (start) {
+            for (uint8_t plane = 0; plane < COUNTER_PLANES; plane++) {
+                if ((DEBOUNCE >> plane) & 1) {
+                    planes[plane] |= start;
+                }
+            }
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
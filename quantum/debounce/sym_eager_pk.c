@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 Basic per-key algorithm. Uses an 8-bit counter per key.
 After pressing a key, it immediately changes state, and sets a counter.
 No further inputs are accepted until DEBOUNCE milliseconds have occurred.
+active_keys holds the keys in their lockout period, which ignore further input.
 */
 
 #include "debounce.h"
@@ -45,6 +46,7 @@ typedef uint8_t debounce_counter_t;
 
 #if DEBOUNCE > 0
 static debounce_counter_t *debounce_counters;
+static matrix_row_t        active_keys[MATRIX_ROWS];
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                matrix_need_update;
@@ -63,6 +65,7 @@ void debounce_init(uint8_t num_rows) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
         }
+        active_keys[r] = 0;
     }
 }
 
@@ -103,45 +106,52 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
 // If the current time is > debounce counter, set the counter to enable input.
 static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time) {
-    counters_need_update                 = false;
-    matrix_need_update                   = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    counters_need_update = false;
+    matrix_need_update   = false;
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (*debounce_pointer != DEBOUNCE_ELAPSED) {
-                if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer  = DEBOUNCE_ELAPSED;
-                    matrix_need_update = true;
-                } else {
-                    *debounce_pointer -= elapsed_time;
-                    counters_need_update = true;
-                }
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+        matrix_row_t        active           = active_keys[row];
+        for (uint8_t col = 0; active; col++) {
+            matrix_row_t col_mask = ROW_SHIFTER << col;
+            if (!(active & col_mask)) {
+                continue;
+            }
+            active &= ~col_mask;
+
+            if (debounce_pointer[col] <= elapsed_time) {
+                debounce_pointer[col] = DEBOUNCE_ELAPSED;
+                active_keys[row] &= ~col_mask;
+                matrix_need_update = true;
+            } else {
+                debounce_pointer[col] -= elapsed_time;
+                counters_need_update = true;
             }
-            debounce_pointer++;
         }
     }
 }
 
 // upload from raw_matrix to final matrix;
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    matrix_need_update                   = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    matrix_need_update = false;
     for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta        = raw[row] ^ cooked[row];
-        matrix_row_t existing_row = cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
-            if (delta & col_mask) {
-                if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
-                    counters_need_update = true;
-                    existing_row ^= col_mask; // flip the bit.
-                    cooked_changed = true;
-                }
+        debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS];
+        // Only keys whose counter has elapsed accept input
+        matrix_row_t started = (raw[row] ^ cooked[row]) & ~active_keys[row];
+        if (!started) {
+            continue;
+        }
+
+        active_keys[row] |= started;
+        cooked[row] ^= started; // flip the bits.
+        for (uint8_t col = 0; started; col++) {
+            matrix_row_t col_mask = ROW_SHIFTER << col;
+            if (started & col_mask) {
+                debounce_pointer[col] = DEBOUNCE;
+                started &= ~col_mask;
             }
-            debounce_pointer++;
         }
-        cooked[row] = existing_row;
+        counters_need_update = true;
+        cooked_changed       = true;
     }
 }
 
@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Prints the average cost of a debounce() call, for comparing algorithms built into separate test binaries. */
+class DebounceBenchmark : public ::testing::Test {
+   protected:
+    void run(const char *scenario, matrix_row_t bouncing_mask, int bounce_period) {
+        const int    iterations = 200000;
+        matrix_row_t raw[MATRIX_ROWS];
+        matrix_row_t cooked[MATRIX_ROWS];
+
+        std::fill(std::begin(raw), std::end(raw), 0);
+        std::fill(std::begin(cooked), std::end(cooked), 0);
+        debounce_init(MATRIX_ROWS);
+        set_time(1000);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            bool changed = bouncing_mask && (i % bounce_period) == 0;
+            if (changed) {
+                for (int row = 0; row < MATRIX_ROWS; row++) {
+                    raw[row] ^= bouncing_mask;
+                }
+            }
+            debounce(raw, cooked, MATRIX_ROWS, changed);
+            advance_time(1);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        debounce_free();
+        printf("debounce %-10s %dx%d: %lld ns/scan\n", scenario, MATRIX_ROWS, MATRIX_COLS, (long long)(elapsed / iterations));
+    }
+};
+
+TEST_F(DebounceBenchmark, Idle) {
+    run("idle", 0, 1);
+}
+
+TEST_F(DebounceBenchmark, OneKeyTyping) {
+    run("one key", 1, 20);
+}
+
+TEST_F(DebounceBenchmark, AllKeysBouncing) {
+    run("all keys", (matrix_row_t)((1ULL << MATRIX_COLS) - 1), 3);
+}
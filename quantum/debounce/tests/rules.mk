@@ -32,7 +32,15 @@ debounce_sym_defer_g_SRC := $(DEBOUNCE_COMMON_SRC) \
 debounce_sym_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
-	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+
+debounce_sym_defer_pk_vc_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_vc_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_vc_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
 
 debounce_sym_defer_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_defer_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
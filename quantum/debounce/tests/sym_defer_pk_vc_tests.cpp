@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// sym_defer_pk_vc also runs sym_defer_pk_tests.cpp, these cover keys which share the bit-sliced counters of a row
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+TEST_F(DebounceTest, VerticalCounterStaggeredRow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 0, DOWN}}, {}},
+        {1, {{0, 1, DOWN}}, {}},
+        {2, {{0, 2, DOWN}}, {}},
+        {3, {{0, 3, DOWN}}, {}},
+        {4, {{0, 4, DOWN}}, {}},
+        {5, {{0, 5, DOWN}}, {{0, 0, DOWN}}},
+        {6, {{0, 6, DOWN}}, {{0, 1, DOWN}}},
+        {7, {{0, 7, DOWN}}, {{0, 2, DOWN}}},
+        {8, {{0, 8, DOWN}}, {{0, 3, DOWN}}},
+        {9, {{0, 9, DOWN}}, {{0, 4, DOWN}}},
+        {10, {}, {{0, 5, DOWN}}},
+        {11, {}, {{0, 6, DOWN}}},
+        {12, {}, {{0, 7, DOWN}}},
+        {13, {}, {{0, 8, DOWN}}},
+        {14, {}, {{0, 9, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, VerticalCounterStaggeredRowDelayedScan) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {3, {{0, 2, DOWN}}, {}},
+        {4, {{0, 9, DOWN}}, {}},
+
+        /* Elapsed time borrows across planes: counters of 2, 4 and 5 drop by 3 */
+        {7, {}, {{0, 1, DOWN}}},
+        /* Counters of 1 and 2 drop by 2, one past zero and one to zero */
+        {9, {}, {{0, 2, DOWN}, {0, 9, DOWN}}},
+    });
+    time_jumps_ = true;
+    runEvents();
+}
+
+TEST_F(DebounceTest, VerticalCounterBounceInSameRow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {2, {{0, 2, DOWN}}, {}},
+        /* Key 2 bounces back before it is debounced, key 1 keeps counting */
+        {3, {{0, 2, UP}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+    });
+    runEvents();
+}
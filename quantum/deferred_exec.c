@@ -13,6 +13,209 @@
 // Helpers
 //
 
+#ifdef DEFERRED_EXEC_HEAP
+
+// Pending executors are kept in a binary min-heap ordered by trigger time. The table entries themselves never move:
+// heap position `i` refers to table entry `table[i].heap_slot`, and `table[n].heap_pos` is the heap position of table
+// entry `n`. Heap positions from the heap size onwards refer to the free table entries.
+
+#    define HEAP_SIZE(table) ((table)[0].heap_size)
+#    define HEAP_ENTRY(table, pos) (&(table)[(table)[(pos)].heap_slot])
+
+static inline bool triggers_before(uint32_t a, uint32_t b) {
+    return ((int32_t)TIMER_DIFF_32(a, b)) < 0;
+}
+
+static void heap_reset(deferred_executor_t *table, size_t table_count) {
+    for (int i = 0; i < table_count; ++i) {
+        table[i].heap_slot = i;
+        table[i].heap_pos  = i;
+    }
+}
+
+static void heap_swap(deferred_executor_t *table, uint8_t a, uint8_t b) {
+    uint8_t slot_a         = table[a].heap_slot;
+    uint8_t slot_b         = table[b].heap_slot;
+    table[a].heap_slot     = slot_b;
+    table[b].heap_slot     = slot_a;
+    table[slot_a].heap_pos = b;
+    table[slot_b].heap_pos = a;
+}
+
+static uint8_t heap_sift_up(deferred_executor_t *table, uint8_t pos) {
+    while (pos > 0) {
+        uint8_t parent = (pos - 1) / 2;
+        if (!triggers_before(HEAP_ENTRY(table, pos)->trigger_time, HEAP_ENTRY(table, parent)->trigger_time)) {
+            break;
+        }
+        heap_swap(table, pos, parent);
+        pos = parent;
+    }
+    return pos;
+}
+
+static void heap_sift_down(deferred_executor_t *table, uint8_t pos) {
+    uint8_t size = HEAP_SIZE(table);
+    while (true) {
+        uint8_t  earliest = pos;
+        uint16_t left     = 2 * pos + 1;
+        uint16_t right    = left + 1;
+        if (left < size && triggers_before(HEAP_ENTRY(table, left)->trigger_time, HEAP_ENTRY(table, earliest)->trigger_time)) {
+            earliest = left;
+        }
+        if (right < size && triggers_before(HEAP_ENTRY(table, right)->trigger_time, HEAP_ENTRY(table, earliest)->trigger_time)) {
+            earliest = right;
+        }
+        if (earliest == pos) {
+            break;
+        }
+        heap_swap(table, pos, earliest);
+        pos = earliest;
+    }
+}
+
+static inline void heap_update(deferred_executor_t *table, uint8_t pos) {
+    heap_sift_down(table, heap_sift_up(table, pos));
+}
+
+static void heap_remove(deferred_executor_t *table, uint8_t pos) {
+    uint8_t last = --HEAP_SIZE(table);
+    if (pos != last) {
+        heap_swap(table, pos, last);
+        heap_update(table, pos);
+    }
+}
+
+static inline void clear_entry(deferred_executor_t *entry) {
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+// Tokens encode the table entry they refer to, with the entry's own generation in the upper range. Every table size
+// leaves room for more than 256 generations, so a stale token only matches once its entry has been reused 256 times.
+static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count, uint8_t slot) {
+    uint8_t generation = table[slot].heap_generation++;
+    return slot + 1 + generation * table_count;
+}
+
+static inline deferred_executor_t *find_token(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    deferred_executor_t *entry = &table[(token - 1) % table_count];
+    return entry->token == token ? entry : NULL;
+}
+
+//------------------------------------
+// Advanced API: used when a custom-allocated table is used, primarily for core code.
+//
+
+deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
+    if (!table || table_count == 0 || table_count > UINT8_MAX || delay_ms == 0 || !callback) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    // Tables start out zeroed, and are re-initialised whenever they drain
+    if (HEAP_SIZE(table) == 0) {
+        heap_reset(table, table_count);
+    }
+
+    // None available
+    if (HEAP_SIZE(table) >= table_count) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    // Claim the first free entry and move it into place
+    uint8_t              pos   = HEAP_SIZE(table)++;
+    deferred_executor_t *entry = HEAP_ENTRY(table, pos);
+    entry->token               = allocate_token(table, table_count, table[pos].heap_slot);
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    heap_sift_up(table, pos);
+    return entry->token;
+}
+
+bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
+    // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
+    if (!table || table_count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+
+    deferred_executor_t *entry = find_token(table, table_count, token);
+    if (!entry) {
+        return false;
+    }
+
+    entry->trigger_time = timer_read32() + delay_ms;
+    heap_update(table, entry->heap_pos);
+    return true;
+}
+
+bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    // Ignore request if the table/token are not valid
+    if (!table || table_count == 0 || token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+
+    deferred_executor_t *entry = find_token(table, table_count, token);
+    if (!entry) {
+        return false;
+    }
+
+    heap_remove(table, entry->heap_pos);
+    clear_entry(entry);
+    return true;
+}
+
+bool deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    if (!table || table_count == 0 || !trigger_time || HEAP_SIZE(table) == 0) {
+        return false;
+    }
+
+    *trigger_time = HEAP_ENTRY(table, 0)->trigger_time;
+    return true;
+}
+
+void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+    uint32_t now = timer_read32();
+
+    // Throttle only once per millisecond
+    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
+        *last_execution_time = now;
+
+        // Run through the due executors in trigger order. Bounded by the number pending beforehand, so an executor that is
+        // still overdue after being re-queued cannot monopolise this pass.
+        for (uint8_t remaining = HEAP_SIZE(table); remaining > 0 && HEAP_SIZE(table) > 0; --remaining) {
+            deferred_executor_t *entry      = HEAP_ENTRY(table, 0);
+            deferred_token       curr_token = entry->token;
+
+            if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token) {
+                continue;
+            }
+
+            if (delay_ms > 0) {
+                // Relative to the previous trigger, as per the linear backend
+                entry->trigger_time += delay_ms;
+                heap_update(table, entry->heap_pos);
+            } else {
+                heap_remove(table, entry->heap_pos);
+                clear_entry(entry);
+            }
+        }
+    }
+}
+
+#else // DEFERRED_EXEC_HEAP
+
 static deferred_token current_token = 0;
 
 static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -156,6 +359,24 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     }
 }
 
+bool deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    bool found = false;
+    if (!table || !trigger_time) {
+        return false;
+    }
+
+    for (int i = 0; i < table_count; ++i) {
+        deferred_executor_t *entry = &table[i];
+        if (entry->token != INVALID_DEFERRED_TOKEN && (!found || ((int32_t)TIMER_DIFF_32(entry->trigger_time, *trigger_time)) < 0)) {
+            *trigger_time = entry->trigger_time;
+            found         = true;
+        }
+    }
+    return found;
+}
+
+#endif // DEFERRED_EXEC_HEAP
+
 //------------------------------------
 // Basic API: used by user-mode code, guaranteed to not collide with core deferred execution
 //
@@ -172,6 +393,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+bool deferred_exec_next_deadline(uint32_t *trigger_time) {
+    return deferred_exec_advanced_next_deadline(basic_executors, MAX_DEFERRED_EXECUTORS, trigger_time);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
@@ -13,8 +13,14 @@
 
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
+ *
+ * The heap backend encodes the table entry and its generation in the token, which needs more than 8 bits.
  */
+#ifdef DEFERRED_EXEC_HEAP
+typedef uint16_t deferred_token;
+#else
 typedef uint8_t deferred_token;
+#endif
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
@@ -60,6 +66,14 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Retrieves the time at which the next deferred execution is due.
+ *
+ * @param trigger_time[out] the trigger time of the earliest pending executor -- equivalent time-space as timer_read32()
+ * @return true if any deferred execution is pending, otherwise false and trigger_time is left untouched
+ */
+bool deferred_exec_next_deadline(uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -79,6 +93,12 @@ typedef struct deferred_executor_t {
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
+#ifdef DEFERRED_EXEC_HEAP
+    uint8_t heap_slot;       // table index of the executor at this heap position
+    uint8_t heap_pos;        // heap position of the executor in this table entry
+    uint8_t heap_size;       // number of pending executors, only maintained in the first table entry
+    uint8_t heap_generation; // bumped whenever this table entry is claimed, so stale tokens do not match
+#endif
 } deferred_executor_t;
 
 /**
@@ -110,6 +130,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Retrieves the time at which the next deferred execution in a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @param trigger_time[out] the trigger time of the earliest pending executor -- equivalent time-space as timer_read32()
+ * @return true if any deferred execution is pending, otherwise false and trigger_time is left untouched
+ */
+bool deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
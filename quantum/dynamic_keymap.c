@@ -18,9 +18,11 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
+#include "util.h"
 
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
@@ -32,6 +34,20 @@
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+// Number of macro buffer bytes fetched from NVM at a time
+#ifndef DYNAMIC_KEYMAP_MACRO_READ_SIZE
+#    define DYNAMIC_KEYMAP_MACRO_READ_SIZE 32
+#endif
+#if DYNAMIC_KEYMAP_MACRO_READ_SIZE > 255
+#    error "DYNAMIC_KEYMAP_MACRO_READ_SIZE must fit in 8 bits"
+#endif
+
+#define DYNAMIC_KEYMAP_MACRO_MISSING UINT16_MAX
+
+// Offset of each macro in the buffer, built on first use
+static uint16_t macro_offsets[DYNAMIC_KEYMAP_MACRO_COUNT];
+static bool     macro_offsets_valid = false;
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -42,6 +58,8 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+    key_action_cache_invalidate_key(layer, MAKE_KEYPOS(row, column));
+    resolved_layer_cache_invalidate_key(MAKE_KEYPOS(row, column));
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -57,6 +75,8 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
 void dynamic_keymap_reset(void) {
     // Erase the keymaps, if necessary.
     nvm_dynamic_keymap_erase();
+    // Erasing may also have taken the macros with it
+    macro_offsets_valid = false;
 
     // Reset the keymaps in EEPROM to what is in flash.
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
@@ -80,6 +100,8 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+    key_action_cache_invalidate();
+    resolved_layer_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -112,6 +134,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_macro_update_buffer(offset, size, data);
+    macro_offsets_valid = false;
 }
 
 static uint8_t dynamic_keymap_read_byte(uint32_t offset) {
@@ -121,20 +144,62 @@ static uint8_t dynamic_keymap_read_byte(uint32_t offset) {
 }
 
 typedef struct send_string_nvm_state_t {
-    uint32_t offset;
+    uint32_t offset; // of the next chunk to fetch
+    uint32_t end;
+    uint8_t  index;
+    uint8_t  length;
+    uint8_t  buffer[DYNAMIC_KEYMAP_MACRO_READ_SIZE];
 } send_string_nvm_state_t;
 
 char send_string_get_next_nvm(void *arg) {
     send_string_nvm_state_t *state = (send_string_nvm_state_t *)arg;
-    char                     ret   = dynamic_keymap_read_byte(state->offset);
-    state->offset++;
-    return ret;
+    if (state->index == state->length) {
+        if (state->offset >= state->end) {
+            return 0;
+        }
+        state->length = MIN(state->end - state->offset, sizeof(state->buffer));
+        state->index  = 0;
+        nvm_dynamic_keymap_macro_read_buffer(state->offset, state->length, state->buffer);
+        state->offset += state->length;
+    }
+    return state->buffer[state->index++];
+}
+
+static void dynamic_keymap_macro_build_offsets(void) {
+    uint8_t  buffer[DYNAMIC_KEYMAP_MACRO_READ_SIZE];
+    uint32_t end      = nvm_dynamic_keymap_macro_size();
+    uint8_t  id       = 0;
+    bool     at_start = true;
+
+    // Each null character starts the next macro
+    for (uint32_t offset = 0; offset < end && id < DYNAMIC_KEYMAP_MACRO_COUNT; offset += sizeof(buffer)) {
+        uint8_t length = MIN(end - offset, sizeof(buffer));
+        nvm_dynamic_keymap_macro_read_buffer(offset, length, buffer);
+        for (uint8_t i = 0; i < length; i++) {
+            if (at_start) {
+                if (id == DYNAMIC_KEYMAP_MACRO_COUNT) {
+                    break;
+                }
+                macro_offsets[id++] = offset + i;
+            }
+            at_start = buffer[i] == 0;
+        }
+    }
+    // A null in the last byte leaves an empty macro behind it
+    if (at_start && id < DYNAMIC_KEYMAP_MACRO_COUNT) {
+        macro_offsets[id++] = end;
+    }
+    while (id < DYNAMIC_KEYMAP_MACRO_COUNT) {
+        macro_offsets[id++] = DYNAMIC_KEYMAP_MACRO_MISSING;
+    }
+    macro_offsets_valid = true;
 }
 
 void dynamic_keymap_macro_reset(void) {
     // Erase the macros, if necessary.
     nvm_dynamic_keymap_macro_erase();
     nvm_dynamic_keymap_macro_reset();
+    macro_offsets_valid = false;
 }
 
 void dynamic_keymap_macro_send(uint8_t id) {
@@ -150,22 +215,15 @@ void dynamic_keymap_macro_send(uint8_t id) {
         return;
     }
 
-    // Skip N null characters
-    // p will then point to the Nth macro
-    uint32_t offset = 0;
-    uint32_t end    = nvm_dynamic_keymap_macro_size();
-    while (id > 0) {
-        // If we are past the end of the buffer, then there is
-        // no Nth macro in the buffer.
-        if (offset == end) {
-            return;
-        }
-        if (dynamic_keymap_read_byte(offset) == 0) {
-            --id;
-        }
-        ++offset;
+    if (!macro_offsets_valid) {
+        dynamic_keymap_macro_build_offsets();
+    }
+    // If there are fewer than N null characters in the
+    // buffer, then there is no Nth macro in the buffer.
+    if (macro_offsets[id] == DYNAMIC_KEYMAP_MACRO_MISSING) {
+        return;
     }
 
-    send_string_nvm_state_t state = {.offset = offset};
+    send_string_nvm_state_t state = {.offset = macro_offsets[id], .end = nvm_dynamic_keymap_macro_size()};
     send_string_with_delay_impl(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY);
 }
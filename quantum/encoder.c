@@ -4,6 +4,7 @@
 #include <string.h>
 #include "action.h"
 #include "encoder.h"
+#include "spsc_queue.h"
 #include "wait.h"
 
 #ifndef ENCODER_MAP_KEY_DELAY
@@ -23,7 +24,7 @@ void encoder_init(void) {
 }
 
 static void encoder_queue_drain(void) {
-    encoder_events.tail     = encoder_events.head;
+    SPSC_STORE_RELEASE(encoder_events.tail, SPSC_LOAD_ACQUIRE(encoder_events.head));
     encoder_events.dequeued = encoder_events.enqueued;
 }
 
@@ -82,8 +83,10 @@ bool encoder_task(void) {
     return changed;
 }
 
+// The queue may be fed from an interrupt (see encoder_quadrature_handle_read()), so the producer
+// only writes head and the consumer only writes tail, each published after its slot access.
 bool encoder_queue_full_advanced(encoder_events_t *events) {
-    return events->tail == (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    return SPSC_LOAD_ACQUIRE(events->tail) == (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
 }
 
 bool encoder_queue_full(void) {
@@ -91,7 +94,7 @@ bool encoder_queue_full(void) {
 }
 
 bool encoder_queue_empty_advanced(encoder_events_t *events) {
-    return events->head == events->tail;
+    return SPSC_LOAD_ACQUIRE(events->head) == events->tail;
 }
 
 bool encoder_queue_empty(void) {
@@ -109,7 +112,7 @@ bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool
     events->queue[events->head] = new_event;
 
     // Increment the head index
-    events->head = (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    SPSC_STORE_RELEASE(events->head, (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS);
     events->enqueued++;
 
     return true;
@@ -126,7 +129,7 @@ bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bo
     *clockwise            = event.clockwise;
 
     // Increment the tail index
-    events->tail = (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    SPSC_STORE_RELEASE(events->tail, (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS);
     events->dequeued++;
 
     return true;
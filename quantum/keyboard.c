@@ -32,6 +32,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "action_tapping.h"
+#include "action_util.h"
+#include "deadline.h"
+#ifdef KEY_EVENT_QUEUE
+#    include "spsc_queue.h"
+#endif
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -107,6 +113,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string_async.h"
+#endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
@@ -149,6 +158,20 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+#ifdef PROFILING_ENABLE
+#    include "profiling.h"
+#endif
+#ifdef TASK_SCHEDULER_ENABLE
+#    include "task_scheduler.h"
+
+static void keyboard_task_scheduler_init(void);
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -545,6 +568,9 @@ void keyboard_init(void) {
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
     debug_enable = true;
 #endif
+#ifdef TASK_SCHEDULER_ENABLE
+    keyboard_task_scheduler_init();
+#endif
 
     keyboard_post_init_quantum(); /* Always keep this last */
 }
@@ -563,16 +589,53 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
 #endif
 }
 
+static uint16_t last_tick = 0;
+
+#ifdef PROFILING_ENABLE
+static profiling_probe_t tick_event_probe = PROFILING_PROBE("tick event");
+#endif
+
+#ifdef TICK_EVENT_ELISION
+/**
+ * @brief Whether a tick event would have nothing to do.
+ *
+ * Tick events only drive the tapping state machine and oneshot timeouts.
+ * Combos, tap dance and the other timed features run from their own tasks.
+ */
+static bool tick_event_is_idle(void) {
+#    ifndef NO_ACTION_TAPPING
+    if (!action_tapping_is_idle()) {
+        return false;
+    }
+#    endif
+#    ifndef NO_ACTION_ONESHOT
+    uint32_t deadline;
+    if (oneshot_next_deadline(&deadline)) {
+        return false;
+    }
+#    endif
+    return true;
+}
+#endif
+
 /**
  * @brief Generates a tick event at a maximum rate of 1KHz that drives the
  * internal QMK state machine.
  */
 static inline void generate_tick_event(void) {
-    static uint16_t last_tick = 0;
-    const uint16_t  now       = timer_read();
+    const uint16_t now = timer_read();
     if (TIMER_DIFF_16(now, last_tick) != 0) {
-        action_exec(MAKE_TICK_EVENT);
         last_tick = now;
+#ifdef TICK_EVENT_ELISION
+        if (tick_event_is_idle()) {
+            return;
+        }
+#endif
+#ifdef PROFILING_ENABLE
+        PROFILE_BLOCK(tick_event_probe, action_exec(MAKE_TICK_EVENT));
+#else
+        action_exec(MAKE_TICK_EVENT);
+#endif
     }
 }
 
@@ -611,6 +674,10 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_matrix_changed();
+#endif
+
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
@@ -625,6 +692,9 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
+#ifdef LATENCY_TRACE_ENABLE
+                    latency_trace_key_event(MAKE_KEYEVENT(row, col, key_pressed));
+#endif
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
                 }
 
@@ -635,165 +705,225 @@ static bool matrix_task(void) {
         matrix_previous[row] = current_row;
     }
 
-    return matrix_changed;
-}
-
-/** \brief Tasks previously located in matrix_scan_quantum
- *
- * TODO: rationalise against keyboard_task and current split role
- */
-void quantum_task(void) {
-#ifdef SPLIT_KEYBOARD
-    // some tasks should only run on master
-    if (!is_keyboard_master()) return;
+#ifdef TICK_EVENT_ELISION
+    // The key events above already advanced the tapping state and oneshot timeouts to
+    // this millisecond, so fold this millisecond's tick into them.
+    if (process_keypress) {
+        last_tick = timer_read();
+    }
 #endif
 
-#ifdef AUDIO_ENABLE
-    audio_task();
-#endif
+    return matrix_changed;
+}
 
-#if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
-    music_task();
-#endif
+/** \brief Set when the matrix or another input changed during the current keyboard_task() */
+static bool activity_has_occurred = false;
 
-#ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
-#endif
+#ifdef KEY_EVENT_QUEUE
+SPSC_QUEUE_DECLARE(queued_key_events, keyevent_t, KEY_EVENT_QUEUE_SIZE);
 
-#ifdef SEQUENCER_ENABLE
-    sequencer_task();
-#endif
+static queued_key_events_t queued_key_events;
 
-#ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
-#endif
+bool key_event_queue_push(uint8_t row, uint8_t col, bool pressed) {
+    const keyevent_t event = MAKE_KEYEVENT(row, col, pressed);
+    return queued_key_events_push(&queued_key_events, &event);
+}
 
-#ifdef COMBO_ENABLE
-    combo_task();
-#endif
+/**
+ * @brief Processes the key events queued by key_event_queue_push(), in the order
+ * they were captured and with the time they were captured at.
+ *
+ * @return true At least one event was processed
+ */
+static bool key_event_queue_task(void) {
+    const bool process_keypress = should_process_keypress();
+    keyevent_t event;
+    bool       changed = false;
 
-#ifdef LEADER_ENABLE
-    leader_task();
-#endif
+    while (queued_key_events_pop(&queued_key_events, &event)) {
+        if (process_keypress) {
+#    ifdef LATENCY_TRACE_ENABLE
+            latency_trace_key_event(event);
+#    endif
+            action_exec(event);
+        }
 
-#ifdef WPM_ENABLE
-    decay_wpm();
-#endif
+        switch_events(event.key.row, event.key.col, event.pressed);
+        changed = true;
+    }
 
-#ifdef DIP_SWITCH_ENABLE
-    dip_switch_task();
-#endif
+#    ifdef TICK_EVENT_ELISION
+    if (changed && process_keypress) {
+        last_tick = timer_read();
+    }
+#    endif
 
-#ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    return changed;
+}
 #endif
 
-#ifdef CAPS_WORD_ENABLE
-    caps_word_task();
-#endif
+static void keyboard_matrix_task(void) {
+    bool changed = false;
 
-#ifdef SECURE_ENABLE
-    secure_task();
+#ifdef KEY_EVENT_QUEUE
+    changed |= key_event_queue_task();
 #endif
+    changed |= matrix_task();
 
-#ifdef LAYER_LOCK_ENABLE
-    layer_lock_task();
-#endif
-}
-
-/** \brief Main task that is repeatedly called as fast as possible. */
-void keyboard_task(void) {
-    __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    if (changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
-
-    quantum_task();
-
-#if defined(SPLIT_WATCHDOG_ENABLE)
-    split_watchdog_task();
-#endif
-
-#if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
-#endif
-
-#ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
-#endif
-#ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
-#endif
-
-#if defined(BACKLIGHT_ENABLE)
-#    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
-#    endif
-#endif
+}
 
 #ifdef ENCODER_ENABLE
+static void encoder_activity_task(void) {
     if (encoder_task()) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
+}
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
+static void pointing_device_activity_task(void) {
     if (pointing_device_task()) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
+}
 #endif
 
 #ifdef OLED_ENABLE
+static void oled_activity_task(void) {
     oled_task();
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
 #    endif
+}
 #endif
 
 #ifdef ST7565_ENABLE
+static void st7565_activity_task(void) {
     st7565_task();
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
 #    endif
+}
 #endif
 
-#ifdef MOUSEKEY_ENABLE
-    // mousekey repeat & acceleration
-    mousekey_task();
+/** \brief Tasks previously located in matrix_scan_quantum
+ *
+ * TODO: rationalise against keyboard_task and current split role
+ */
+void quantum_task(void) {
+#ifdef SPLIT_KEYBOARD
+    // some tasks should only run on master
+    if (!is_keyboard_master()) return;
 #endif
 
-#ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
-#endif
+#define QUANTUM_TASK(task, period) task();
+#define KEYBOARD_TASK(task, period)
+#include "keyboard_tasks.inc"
+#undef QUANTUM_TASK
+#undef KEYBOARD_TASK
+}
 
-#ifdef MIDI_ENABLE
-    midi_task();
-#endif
+#ifdef TASK_SCHEDULER_ENABLE
+static scheduled_task_t matrix_scheduled_task = {.name = "matrix_task", .task = keyboard_matrix_task, .priority = TASK_PRIORITY_MATRIX};
 
-#ifdef JOYSTICK_ENABLE
-    joystick_task();
-#endif
+#    define QUANTUM_TASK(task_fn, task_period) static scheduled_task_t task_fn##_scheduled_task = {.name = #task_fn, .task = task_fn, .period = task_period, .priority = TASK_PRIORITY_QUANTUM};
+#    define KEYBOARD_TASK(task_fn, task_period) static scheduled_task_t task_fn##_scheduled_task = {.name = #task_fn, .task = task_fn, .period = task_period, .priority = TASK_PRIORITY_KEYBOARD};
+#    include "keyboard_tasks.inc"
+#    undef QUANTUM_TASK
+#    undef KEYBOARD_TASK
 
-#ifdef BATTERY_ENABLE
-    battery_task();
-#endif
+/** \brief Registers the matrix scan and the built-in tasks with the task scheduler.
+ *
+ * The matrix scan has the highest possible priority value and is registered first, so it always runs first.
+ */
+static void keyboard_task_scheduler_init(void) {
+    task_scheduler_register(&matrix_scheduled_task);
 
-#ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+#    ifdef SPLIT_KEYBOARD
+    // some tasks should only run on master
+    __attribute__((unused)) const bool master = is_keyboard_master();
+#    else
+    __attribute__((unused)) const bool master = true;
+#    endif
+#    define QUANTUM_TASK(task_fn, task_period) \
+        if (master) task_scheduler_register(&task_fn##_scheduled_task);
+#    define KEYBOARD_TASK(task_fn, task_period) task_scheduler_register(&task_fn##_scheduled_task);
+#    include "keyboard_tasks.inc"
+#    undef QUANTUM_TASK
+#    undef KEYBOARD_TASK
+}
 #endif
 
-#ifdef HAPTIC_ENABLE
-    haptic_task();
+/** \brief Collects the next deadline reported by a single subsystem. */
+static inline void next_deadline_collect(bool *pending, uint32_t *earliest, bool (*next_deadline)(uint32_t *)) {
+    uint32_t deadline;
+    if (next_deadline(&deadline)) {
+        deadline_merge(pending, earliest, deadline);
+    }
+}
+
+/** \brief Retrieves the earliest time at which a timer-driven input processing state changes.
+ *
+ * Covers tapping and oneshot timeouts (driven by tick events), as well as the combo, tap dance,
+ * leader, Caps Word and Auto Shift timers and deferred executors. Until the returned deadline
+ * the keyboard only needs to run again when the matrix or another input changes.
+ */
+bool keyboard_next_deadline(uint32_t *deadline) {
+    bool pending = false;
+
+#ifndef NO_ACTION_TAPPING
+    next_deadline_collect(&pending, deadline, action_tapping_next_deadline);
+#endif
+#ifndef NO_ACTION_ONESHOT
+    next_deadline_collect(&pending, deadline, oneshot_next_deadline);
+#endif
+#ifdef TAP_DANCE_ENABLE
+    next_deadline_collect(&pending, deadline, tap_dance_next_deadline);
+#endif
+#ifdef COMBO_ENABLE
+    next_deadline_collect(&pending, deadline, combo_next_deadline);
+#endif
+#ifdef LEADER_ENABLE
+    next_deadline_collect(&pending, deadline, leader_next_deadline);
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+    next_deadline_collect(&pending, deadline, autoshift_next_deadline);
+#endif
+#ifdef CAPS_WORD_ENABLE
+    next_deadline_collect(&pending, deadline, caps_word_next_deadline);
+#endif
+#ifdef DEFERRED_EXEC_ENABLE
+    next_deadline_collect(&pending, deadline, deferred_exec_next_deadline);
+#endif
+#ifdef SEND_STRING_ASYNC_ENABLE
+    next_deadline_collect(&pending, deadline, send_string_async_next_deadline);
 #endif
 
-    led_task();
+    return pending;
+}
 
-#ifdef OS_DETECTION_ENABLE
-    os_detection_task();
+/** \brief Main task that is repeatedly called as fast as possible. */
+void keyboard_task(void) {
+    activity_has_occurred = false;
+
+#ifdef TASK_SCHEDULER_ENABLE
+    task_scheduler_run();
+#else
+    keyboard_matrix_task();
+    quantum_task();
+
+#    define QUANTUM_TASK(task, period)
+#    define KEYBOARD_TASK(task, period) task();
+#    include "keyboard_tasks.inc"
+#    undef QUANTUM_TASK
+#    undef KEYBOARD_TASK
 #endif
 }
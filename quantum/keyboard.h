@@ -109,6 +109,15 @@ void keyboard_setup(void);
 void keyboard_init(void);
 /* it runs repeatedly in main loop */
 void keyboard_task(void);
+/* earliest time (timer_read32() time-space) at which keyboard_task() has timer-driven work; false if none is pending */
+bool keyboard_next_deadline(uint32_t *deadline);
+#ifdef KEY_EVENT_QUEUE
+#    ifndef KEY_EVENT_QUEUE_SIZE
+#        define KEY_EVENT_QUEUE_SIZE 16
+#    endif
+/* queues a key event captured outside of the matrix scan (e.g. by a scan interrupt) with the current time; lock-free, false if the queue is full */
+bool key_event_queue_push(uint8_t row, uint8_t col, bool pressed);
+#endif
 /* it runs whenever code has to behave differently on a slave */
 bool is_keyboard_master(void);
 /* it runs whenever code has to behave differently on left vs right split */
@@ -14,6 +14,7 @@
 
 #include "keycode_string.h"
 
+#include <stdbool.h>
 #include <string.h>
 #include "bitwise.h"
 #include "keycode.h"
@@ -39,6 +40,9 @@ typedef int_fast8_t index_t;
  *
  * To save memory, feature-specific key entries are ifdef'd to include them only
  * when their feature is enabled.
+ *
+ * Entries must be sorted by keycode, as search_common_names() does a binary
+ * search of the table.
  */
 static const uint16_t common_names[] PROGMEM = {
     KC_TRNS, KEYCODE_NAME7('K', 'C', '_', 'T', 'R', 'N', 'S'),
@@ -73,70 +77,70 @@ static const uint16_t common_names[] PROGMEM = {
     KC_DOWN, KEYCODE_NAME7('K', 'C', '_', 'D', 'O', 'W', 'N'),
     KC_UP  , KEYCODE_NAME7('K', 'C', '_', 'U', 'P',  0 ,  0 ),
     KC_NUBS, KEYCODE_NAME7('K', 'C', '_', 'N', 'U', 'B', 'S'),
-    KC_HYPR, KEYCODE_NAME7('K', 'C', '_', 'H', 'Y', 'P', 'R'),
-    KC_MEH , KEYCODE_NAME7('K', 'C', '_', 'M', 'E', 'H',  0 ),
 #ifdef EXTRAKEY_ENABLE
+    KC_MUTE, KEYCODE_NAME7('K', 'C', '_', 'M', 'U', 'T', 'E'),
+    KC_VOLU, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'U'),
+    KC_VOLD, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'D'),
+    KC_MNXT, KEYCODE_NAME7('K', 'C', '_', 'M', 'N', 'X', 'T'),
+    KC_MPRV, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'R', 'V'),
+    KC_MPLY, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'L', 'Y'),
     KC_WHOM, KEYCODE_NAME7('K', 'C', '_', 'W', 'H', 'O', 'M'),
     KC_WBAK, KEYCODE_NAME7('K', 'C', '_', 'W', 'B', 'A', 'K'),
     KC_WFWD, KEYCODE_NAME7('K', 'C', '_', 'W', 'F', 'W', 'D'),
     KC_WSTP, KEYCODE_NAME7('K', 'C', '_', 'W', 'S', 'T', 'P'),
     KC_WREF, KEYCODE_NAME7('K', 'C', '_', 'W', 'R', 'E', 'F'),
-    KC_MNXT, KEYCODE_NAME7('K', 'C', '_', 'M', 'N', 'X', 'T'),
-    KC_MPRV, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'R', 'V'),
-    KC_MPLY, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'L', 'Y'),
-    KC_MUTE, KEYCODE_NAME7('K', 'C', '_', 'M', 'U', 'T', 'E'),
-    KC_VOLU, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'U'),
-    KC_VOLD, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'D'),
 #endif // EXTRAKEY_ENABLE
 #ifdef MOUSEKEY_ENABLE
-    MS_LEFT, KEYCODE_NAME7('M', 'S', '_', 'L', 'E', 'F', 'T'),
-    MS_RGHT, KEYCODE_NAME7('M', 'S', '_', 'R', 'G', 'H', 'T'),
     MS_UP  , KEYCODE_NAME7('M', 'S', '_', 'U', 'P',  0 ,  0 ),
     MS_DOWN, KEYCODE_NAME7('M', 'S', '_', 'D', 'O', 'W', 'N'),
-    MS_WHLL, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'L'),
-    MS_WHLR, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'R'),
+    MS_LEFT, KEYCODE_NAME7('M', 'S', '_', 'L', 'E', 'F', 'T'),
+    MS_RGHT, KEYCODE_NAME7('M', 'S', '_', 'R', 'G', 'H', 'T'),
     MS_WHLU, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'U'),
     MS_WHLD, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'D'),
+    MS_WHLL, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'L'),
+    MS_WHLR, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'R'),
 #endif // MOUSEKEY_ENABLE
+    KC_MEH , KEYCODE_NAME7('K', 'C', '_', 'M', 'E', 'H',  0 ),
+    KC_HYPR, KEYCODE_NAME7('K', 'C', '_', 'H', 'Y', 'P', 'R'),
 #ifdef SWAP_HANDS_ENABLE
-    SH_ON  , KEYCODE_NAME7('S', 'H', '_', 'O', 'N',  0 ,  0 ),
-    SH_OFF , KEYCODE_NAME7('S', 'H', '_', 'O', 'F', 'F',  0 ),
-    SH_MON , KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'N',  0 ),
-    SH_MOFF, KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'F', 'F'),
     SH_TOGG, KEYCODE_NAME7('S', 'H', '_', 'T', 'O', 'G', 'G'),
     SH_TT  , KEYCODE_NAME7('S', 'H', '_', 'T', 'T',  0 ,  0 ),
+    SH_MON , KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'N',  0 ),
+    SH_MOFF, KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'F', 'F'),
+    SH_OFF , KEYCODE_NAME7('S', 'H', '_', 'O', 'F', 'F',  0 ),
+    SH_ON  , KEYCODE_NAME7('S', 'H', '_', 'O', 'N',  0 ,  0 ),
 #    if !defined(NO_ACTION_ONESHOT)
     SH_OS  , KEYCODE_NAME7('S', 'H', '_', 'O', 'S',  0 ,  0 ),
 #    endif // !defined(NO_ACTION_ONESHOT)
 #endif // SWAP_HANDS_ENABLE
+    QK_BOOT, KEYCODE_NAME7('Q', 'K', '_', 'B', 'O', 'O', 'T'),
+    DB_TOGG, KEYCODE_NAME7('D', 'B', '_', 'T', 'O', 'G', 'G'),
+    EE_CLR , KEYCODE_NAME7('E', 'E', '_', 'C', 'L', 'R',  0 ),
+#ifdef GRAVE_ESC_ENABLE
+    QK_GESC, KEYCODE_NAME7('Q', 'K', '_', 'G', 'E', 'S', 'C'),
+#endif // GRAVE_ESC_ENABLE
 #ifdef LEADER_ENABLE
     QK_LEAD, KEYCODE_NAME7('Q', 'K', '_', 'L', 'E', 'A', 'D'),
 #endif // LEADER_ENABLE
 #ifdef KEY_LOCK_ENABLE
     QK_LOCK, KEYCODE_NAME7('Q', 'K', '_', 'L', 'O', 'C', 'K'),
 #endif // KEY_LOCK_ENABLE
-#ifdef TRI_LAYER_ENABLE
-    TL_LOWR, KEYCODE_NAME7('T', 'L', '_', 'L', 'O', 'W', 'R'),
-    TL_UPPR, KEYCODE_NAME7('T', 'L', '_', 'U', 'P', 'P', 'R'),
-#endif // TRI_LAYER_ENABLE
-#ifdef GRAVE_ESC_ENABLE
-    QK_GESC, KEYCODE_NAME7('Q', 'K', '_', 'G', 'E', 'S', 'C'),
-#endif // GRAVE_ESC_ENABLE
-#ifdef CAPS_WORD_ENABLE
-    CW_TOGG, KEYCODE_NAME7('C', 'W', '_', 'T', 'O', 'G', 'G'),
-#endif // CAPS_WORD_ENABLE
 #ifdef SECURE_ENABLE
     SE_LOCK, KEYCODE_NAME7('S', 'E', '_', 'L', 'O', 'C', 'K'),
     SE_UNLK, KEYCODE_NAME7('S', 'E', '_', 'U', 'N', 'L', 'K'),
     SE_TOGG, KEYCODE_NAME7('S', 'E', '_', 'T', 'O', 'G', 'G'),
     SE_REQ , KEYCODE_NAME7('S', 'E', '_', 'R', 'E', 'Q',  0 ),
 #endif // SECURE_ENABLE
+#ifdef CAPS_WORD_ENABLE
+    CW_TOGG, KEYCODE_NAME7('C', 'W', '_', 'T', 'O', 'G', 'G'),
+#endif // CAPS_WORD_ENABLE
+#ifdef TRI_LAYER_ENABLE
+    TL_LOWR, KEYCODE_NAME7('T', 'L', '_', 'L', 'O', 'W', 'R'),
+    TL_UPPR, KEYCODE_NAME7('T', 'L', '_', 'U', 'P', 'P', 'R'),
+#endif // TRI_LAYER_ENABLE
 #ifdef LAYER_LOCK_ENABLE
     QK_LLCK, KEYCODE_NAME7('Q', 'K', '_', 'L', 'L', 'C', 'K'),
 #endif // LAYER_LOCK_ENABLE
-    EE_CLR , KEYCODE_NAME7('E', 'E', '_', 'C', 'L', 'R',  0 ),
-    QK_BOOT, KEYCODE_NAME7('Q', 'K', '_', 'B', 'O', 'O', 'T'),
-    DB_TOGG, KEYCODE_NAME7('D', 'B', '_', 'T', 'O', 'G', 'G'),
 };
 // clang-format on
 
@@ -153,23 +157,46 @@ static char buffer[32];
 #define BUFFER_MAX_LEN (sizeof(buffer) - 1)
 static index_t buffer_len;
 
+/**
+ * @brief Lookup info about a names table, gathered the first time it is searched.
+ */
+typedef struct {
+    bool     scanned;
+    bool     sorted;
+    uint16_t min_keycode;
+    uint16_t max_keycode;
+} table_info_t;
+
+static table_info_t table_info_user;
+static table_info_t table_info_kb;
+
 /** Finds the name of a keycode in `common_names` or returns NULL. */
 static const char* search_common_names(uint16_t keycode) {
     static uint8_t buffer[8];
 
-    for (int_fast16_t offset = 0; offset < ARRAY_SIZE(common_names); offset += 4) {
-        if (keycode == pgm_read_word(common_names + offset)) {
-            const uint16_t w0 = pgm_read_word(common_names + offset + 1);
-            const uint16_t w1 = pgm_read_word(common_names + offset + 2);
-            const uint16_t w2 = pgm_read_word(common_names + offset + 3);
-            buffer[0]         = (uint8_t)w0;
-            buffer[1]         = (uint8_t)(w0 >> 8);
-            buffer[2]         = '_';
-            buffer[3]         = (uint8_t)w1;
-            buffer[4]         = (uint8_t)(w1 >> 8);
-            buffer[5]         = (uint8_t)w2;
-            buffer[6]         = (uint8_t)(w2 >> 8);
-            buffer[7]         = 0;
+    // Binary search for the entry, each entry is 4 words.
+    int_fast16_t lo = 0;
+    int_fast16_t hi = ARRAY_SIZE(common_names) / 4;
+    while (lo < hi) {
+        const int_fast16_t mid   = (lo + hi) / 2;
+        const uint16_t     found = pgm_read_word(common_names + 4 * mid);
+        if (found < keycode) {
+            lo = mid + 1;
+        } else if (found > keycode) {
+            hi = mid;
+        } else {
+            const int_fast16_t offset = 4 * mid;
+            const uint16_t     w0     = pgm_read_word(common_names + offset + 1);
+            const uint16_t     w1     = pgm_read_word(common_names + offset + 2);
+            const uint16_t     w2     = pgm_read_word(common_names + offset + 3);
+            buffer[0]                 = (uint8_t)w0;
+            buffer[1]                 = (uint8_t)(w0 >> 8);
+            buffer[2]                 = '_';
+            buffer[3]                 = (uint8_t)w1;
+            buffer[4]                 = (uint8_t)(w1 >> 8);
+            buffer[5]                 = (uint8_t)w2;
+            buffer[6]                 = (uint8_t)(w2 >> 8);
+            buffer[7]                 = 0;
             return (const char*)buffer;
         }
     }
@@ -177,19 +204,68 @@ static const char* search_common_names(uint16_t keycode) {
     return NULL;
 }
 
+bool keycode_string_common_names_sorted(void) {
+    for (uint_fast16_t i = 4; i < ARRAY_SIZE(common_names); i += 4) {
+        if (pgm_read_word(common_names + i) <= pgm_read_word(common_names + i - 4)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
  * @brief Finds the name of a keycode in table or returns NULL.
  *
+ * Keycodes outside of the range covered by the table are rejected without a
+ * search. Tables listed in ascending keycode order are binary searched, other
+ * tables are scanned linearly.
+ *
  * @param data   Pointer to table to be searched.
  * @param size   Numer of entries in the table.
+ * @param info   Lookup info about the table.
  * @return Name string for the keycode, or NULL if not found.
  */
-static const char* search_table(const keycode_string_name_t* data, uint16_t size, uint16_t keycode) {
-    if (data != NULL) {
-        for (uint16_t i = 0; i < size; ++i) {
-            if (data[i].keycode == keycode) {
-                return data[i].name;
+static const char* search_table(const keycode_string_name_t* data, uint16_t size, table_info_t* info, uint16_t keycode) {
+    if (data == NULL || size == 0) {
+        return NULL;
+    }
+
+    if (!info->scanned) {
+        info->scanned     = true;
+        info->sorted      = true;
+        info->min_keycode = data[0].keycode;
+        info->max_keycode = data[0].keycode;
+        for (uint16_t i = 1; i < size; ++i) {
+            if (data[i].keycode < data[i - 1].keycode) {
+                info->sorted = false;
             }
+            info->min_keycode = MIN(info->min_keycode, data[i].keycode);
+            info->max_keycode = MAX(info->max_keycode, data[i].keycode);
+        }
+    }
+
+    if (keycode < info->min_keycode || keycode > info->max_keycode) {
+        return NULL;
+    }
+
+    if (info->sorted) {
+        // Find the first entry for the keycode, as the linear scan would.
+        uint16_t lo = 0;
+        uint16_t hi = size;
+        while (lo < hi) {
+            const uint16_t mid = lo + (hi - lo) / 2;
+            if (data[mid].keycode < keycode) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return (lo < size && data[lo].keycode == keycode) ? data[lo].name : NULL;
+    }
+
+    for (uint16_t i = 0; i < size; ++i) {
+        if (data[i].keycode == keycode) {
+            return data[i].name;
         }
     }
     return NULL;
@@ -289,12 +365,12 @@ static void append_numbered_keycode(const char* name, uint16_t number) {
 static void append_keycode(uint16_t keycode) {
     // In case there is overlap among tables, search `keycode_string_names_user`
     // first so that it takes precedence.
-    const char* keycode_name = search_table(keycode_string_names_data_user, keycode_string_names_size_user, keycode);
+    const char* keycode_name = search_table(keycode_string_names_data_user, keycode_string_names_size_user, &table_info_user, keycode);
     if (keycode_name) {
         append(keycode_name);
         return;
     }
-    keycode_name = search_table(keycode_string_names_data_kb, keycode_string_names_size_kb, keycode);
+    keycode_name = search_table(keycode_string_names_data_kb, keycode_string_names_size_kb, &table_info_kb, keycode);
     if (keycode_name) {
         append(keycode_name);
         return;
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #if KEYCODE_STRING_ENABLE
@@ -119,6 +120,12 @@ extern uint16_t                     keycode_string_names_size_user;
 extern const keycode_string_name_t* keycode_string_names_data_kb;
 extern uint16_t                     keycode_string_names_size_kb;
 
+/**
+ * @brief Checks that the built-in names are in strictly ascending keycode
+ * order, as their binary search requires. Used by the unit tests.
+ */
+bool keycode_string_common_names_sorted(void);
+
 #else
 
 // When keycode_string is disabled, fall back to printing keycodes numerically
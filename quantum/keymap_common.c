@@ -45,8 +45,59 @@ extern keymap_config_t keymap_config;
 
 #include <inttypes.h>
 
+#ifdef KEY_ACTION_CACHE
+#    include <limits.h>
+#    include <string.h>
+
+/** \brief key action cache
+ *
+ * The action of every matrix position on the lowest KEY_ACTION_CACHE_LAYERS layers, so that the
+ * keymap read, keycode_config() remapping and keycode decoding happen once per key rather than on
+ * every lookup. Entries are filled lazily on first use, and the whole cache is dropped when
+ * keymap_config changes, as that changes how keycodes are remapped.
+ */
+#    ifndef KEY_ACTION_CACHE_LAYERS
+#        define KEY_ACTION_CACHE_LAYERS 4
+#    endif
+
+static action_t key_action_cache[KEY_ACTION_CACHE_LAYERS][MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  key_action_cache_valid[((KEY_ACTION_CACHE_LAYERS * MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)] = {0};
+static uint16_t key_action_cache_config;
+
+void key_action_cache_invalidate(void) {
+    memset(key_action_cache_valid, 0, sizeof(key_action_cache_valid));
+    key_action_cache_config = keymap_config.raw;
+}
+
+void key_action_cache_invalidate_key(uint8_t layer, keypos_t key) {
+    if (layer >= KEY_ACTION_CACHE_LAYERS || key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return;
+    }
+    // Refilled by the next action_for_key(), which reads the keycode the same way as any other lookup
+    const uint16_t entry_number = (uint16_t)((layer * MATRIX_ROWS + key.row) * MATRIX_COLS) + key.col;
+    key_action_cache_valid[entry_number / (CHAR_BIT)] &= ~(1U << (entry_number % (CHAR_BIT)));
+}
+#endif
+
 /* converts key to action */
 action_t action_for_key(uint8_t layer, keypos_t key) {
+#ifdef KEY_ACTION_CACHE
+    if (layer < KEY_ACTION_CACHE_LAYERS && key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        if (key_action_cache_config != keymap_config.raw) {
+            key_action_cache_invalidate();
+        }
+
+        const uint16_t entry_number = (uint16_t)((layer * MATRIX_ROWS + key.row) * MATRIX_COLS) + key.col;
+        const uint16_t storage_idx  = entry_number / (CHAR_BIT);
+        const uint8_t  storage_bit  = 1U << (entry_number % (CHAR_BIT));
+
+        if (!(key_action_cache_valid[storage_idx] & storage_bit)) {
+            key_action_cache[layer][key.row][key.col] = action_for_keycode(keymap_key_to_keycode(layer, key));
+            key_action_cache_valid[storage_idx] |= storage_bit;
+        }
+        return key_action_cache[layer][key.row][key.col];
+    }
+#endif
     // 16bit keycodes - important
     uint16_t keycode = keymap_key_to_keycode(layer, key);
     return action_for_keycode(keycode);
@@ -119,6 +119,14 @@ __attribute__((weak)) combo_t* combo_get(uint16_t combo_idx) {
     return combo_get_raw(combo_idx);
 }
 
+#    if defined(COMBO_KEY_INDEX)
+static uint8_t combo_key_index[COMBO_KEY_INDEX_BUCKETS][(ARRAY_SIZE(key_combos) + 7) / 8];
+
+uint8_t* combo_key_index_storage(void) {
+    return &combo_key_index[0][0];
+}
+#    endif // defined(COMBO_KEY_INDEX)
+
 #endif // defined(COMBO_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +183,14 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+#    if defined(KEY_OVERRIDE_INDEX)
+static uint8_t key_override_index[KEY_OVERRIDE_INDEX_BUCKETS + KEY_OVERRIDE_INDEX_MOD_BUCKETS][(ARRAY_SIZE(key_overrides) + 7) / 8];
+
+uint8_t* key_override_index_storage(void) {
+    return &key_override_index[0][0];
+}
+#    endif // defined(KEY_OVERRIDE_INDEX)
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
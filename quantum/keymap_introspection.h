@@ -66,6 +66,11 @@ combo_t* combo_get_raw(uint16_t combo_idx);
 // Get the combo definition, potentially stored dynamically
 combo_t* combo_get(uint16_t combo_idx);
 
+#    if defined(COMBO_KEY_INDEX)
+// Get the storage for the keycode to combo index, COMBO_KEY_INDEX_BUCKETS bitsets of combo_count_raw() bits each
+uint8_t* combo_key_index_storage(void);
+#    endif // defined(COMBO_KEY_INDEX)
+
 #endif // defined(COMBO_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,4 +113,9 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+#    if defined(KEY_OVERRIDE_INDEX)
+// Get the storage for the trigger to key override index, KEY_OVERRIDE_INDEX_BUCKETS + KEY_OVERRIDE_INDEX_MOD_BUCKETS bitsets of key_override_count_raw() bits each
+uint8_t* key_override_index_storage(void);
+#    endif // defined(KEY_OVERRIDE_INDEX)
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
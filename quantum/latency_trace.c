@@ -0,0 +1,167 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "latency_trace.h"
+#include "timer.h"
+
+typedef enum {
+    LATENCY_PENDING_FREE = 0,
+    LATENCY_PENDING_DETECTED,
+    LATENCY_PENDING_PROCESSING,
+} latency_pending_state_t;
+
+typedef struct {
+    keypos_t key;
+    bool     pressed;
+    uint8_t  state;
+    uint32_t raw_ts;
+    uint32_t detect_ts;
+    uint32_t process_ts;
+} latency_pending_t;
+
+static latency_pending_t pending[LATENCY_TRACE_MAX_PENDING];
+
+static profiling_probe_t stages[LATENCY_STAGE_COUNT] = {
+    [LATENCY_STAGE_DEBOUNCE]       = PROFILING_PROBE("debounce"),
+    [LATENCY_STAGE_TAPPING]        = PROFILING_PROBE("tapping"),
+    [LATENCY_STAGE_PROCESS_RECORD] = PROFILING_PROBE("process_record"),
+    [LATENCY_STAGE_REPORT_SEND]    = PROFILING_PROBE("report_send"),
+    [LATENCY_STAGE_TOTAL]          = PROFILING_PROBE("total"),
+};
+
+static bool     raw_change_pending = false;
+static uint32_t raw_change_ts      = 0;
+static uint32_t matrix_raw_ts      = 0;
+static uint32_t matrix_detect_ts   = 0;
+static uint32_t report_begin_ts    = 0;
+
+void latency_trace_clear(void) {
+    for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        profiling_probe_clear(&stages[stage]);
+    }
+    memset(pending, 0, sizeof(pending));
+    raw_change_pending = false;
+}
+
+const profiling_probe_t *latency_trace_get_probe(latency_stage_t stage) {
+    if (stage >= LATENCY_STAGE_COUNT) {
+        return NULL;
+    }
+    return &stages[stage];
+}
+
+const char *latency_trace_stage_name(latency_stage_t stage) {
+    if (stage >= LATENCY_STAGE_COUNT) {
+        return "unknown";
+    }
+    return stages[stage].name;
+}
+
+static latency_pending_t *find_pending(keyevent_t event, uint8_t state) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_MAX_PENDING; i++) {
+        latency_pending_t *p = &pending[i];
+        if (p->state == state && p->pressed == event.pressed && KEYEQ(p->key, event.key)) {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+void latency_trace_matrix_raw_change(void) {
+    uint32_t now = timer_read_stamp();
+    if (!raw_change_pending || timer_stamp_diff_us(now, raw_change_ts) > LATENCY_TRACE_STALE_US) {
+        raw_change_ts      = now;
+        raw_change_pending = true;
+    }
+}
+
+void latency_trace_matrix_changed(void) {
+    matrix_detect_ts = timer_read_stamp();
+    if (raw_change_pending && timer_stamp_diff_us(matrix_detect_ts, raw_change_ts) <= LATENCY_TRACE_STALE_US) {
+        matrix_raw_ts = raw_change_ts;
+    } else {
+        // Custom matrix implementations may not report raw changes at all
+        matrix_raw_ts = matrix_detect_ts;
+    }
+    raw_change_pending = false;
+}
+
+void latency_trace_key_event(keyevent_t event) {
+    latency_pending_t *slot = find_pending(event, LATENCY_PENDING_DETECTED);
+    for (uint8_t i = 0; !slot && i < LATENCY_TRACE_MAX_PENDING; i++) {
+        if (pending[i].state == LATENCY_PENDING_FREE) {
+            slot = &pending[i];
+        }
+    }
+    if (!slot) {
+        // Table is full, evict the oldest in-flight event
+        slot = &pending[0];
+        for (uint8_t i = 1; i < LATENCY_TRACE_MAX_PENDING; i++) {
+            if (timer_stamp_diff_us(matrix_detect_ts, pending[i].detect_ts) > timer_stamp_diff_us(matrix_detect_ts, slot->detect_ts)) {
+                slot = &pending[i];
+            }
+        }
+    }
+
+    slot->key       = event.key;
+    slot->pressed   = event.pressed;
+    slot->state     = LATENCY_PENDING_DETECTED;
+    slot->raw_ts    = matrix_raw_ts;
+    slot->detect_ts = matrix_detect_ts;
+}
+
+void latency_trace_record_begin(keyevent_t event) {
+    if (!IS_KEYEVENT(event)) {
+        return;
+    }
+    latency_pending_t *p = find_pending(event, LATENCY_PENDING_DETECTED);
+    if (p) {
+        p->state      = LATENCY_PENDING_PROCESSING;
+        p->process_ts = timer_read_stamp();
+    }
+}
+
+void latency_trace_record_end(keyevent_t event) {
+    if (!IS_KEYEVENT(event)) {
+        return;
+    }
+    // If the event is still in flight it never generated a report, so drop it
+    latency_pending_t *p = find_pending(event, LATENCY_PENDING_PROCESSING);
+    if (p) {
+        p->state = LATENCY_PENDING_FREE;
+    }
+}
+
+void latency_trace_report_begin(void) {
+    report_begin_ts = timer_read_stamp();
+}
+
+void latency_trace_report_end(void) {
+    uint32_t now = timer_read_stamp();
+    for (uint8_t i = 0; i < LATENCY_TRACE_MAX_PENDING; i++) {
+        latency_pending_t *p = &pending[i];
+        if (p->state != LATENCY_PENDING_PROCESSING) {
+            continue;
+        }
+        profiling_probe_add(&stages[LATENCY_STAGE_DEBOUNCE], timer_stamp_diff_us(p->detect_ts, p->raw_ts));
+        profiling_probe_add(&stages[LATENCY_STAGE_TAPPING], timer_stamp_diff_us(p->process_ts, p->detect_ts));
+        profiling_probe_add(&stages[LATENCY_STAGE_PROCESS_RECORD], timer_stamp_diff_us(report_begin_ts, p->process_ts));
+        profiling_probe_add(&stages[LATENCY_STAGE_REPORT_SEND], timer_stamp_diff_us(now, report_begin_ts));
+        profiling_probe_add(&stages[LATENCY_STAGE_TOTAL], timer_stamp_diff_us(now, p->raw_ts));
+        p->state = LATENCY_PENDING_FREE;
+    }
+}
+
+void latency_trace_print(void) {
+    for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        profiling_probe_print("latency", &stages[stage]);
+    }
+}
+
+bool latency_trace_raw_hid_fill(uint8_t *data, uint8_t length) {
+    if (data[1] >= LATENCY_STAGE_COUNT) {
+        return false;
+    }
+    return profiling_probe_raw_hid_fill(&stages[data[1]], data, length);
+}
@@ -0,0 +1,94 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/*
+    This API records end-to-end latency of key events, from the moment the
+    matrix scan first notices an electrical change through to the point where
+    the resulting HID report has been handed to the host driver.
+
+    Each key event is timestamped at the following points:
+
+        raw      -- matrix_scan() sees the raw (undebounced) matrix change
+        detected -- matrix_task() sees the debounced change
+        process  -- process_record() starts handling the event
+        send     -- host_keyboard_send() / host_nkro_send() is entered
+        sent     -- the host driver has accepted the report
+
+    The deltas between those points are accumulated into one profiling
+    probe per stage, see profiling.h for the statistics and histogram
+    they hold:
+
+        LATENCY_STAGE_DEBOUNCE       -- raw      -> detected
+        LATENCY_STAGE_TAPPING        -- detected -> process (tapping state machine and waiting_buffer)
+        LATENCY_STAGE_PROCESS_RECORD -- process  -> send    (process_record chain)
+        LATENCY_STAGE_REPORT_SEND    -- send     -> sent    (host driver)
+        LATENCY_STAGE_TOTAL          -- raw      -> sent
+
+    Events which never produce a keyboard report (layer keys, swallowed
+    keycodes, etc.) are discarded once process_record() completes.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "keyboard.h"
+#include "profiling.h"
+
+/**
+ * @def Maximum number of key events that can be in flight at the same time, e.g. held in the tapping waiting_buffer.
+ */
+#ifndef LATENCY_TRACE_MAX_PENDING
+#    define LATENCY_TRACE_MAX_PENDING 8
+#endif
+
+/**
+ * @def Raw matrix changes older than this (in microseconds) are considered rejected bounces, and are not attributed to the next debounced change.
+ */
+#ifndef LATENCY_TRACE_STALE_US
+#    define LATENCY_TRACE_STALE_US 50000
+#endif
+
+typedef enum {
+    LATENCY_STAGE_DEBOUNCE,
+    LATENCY_STAGE_TAPPING,
+    LATENCY_STAGE_PROCESS_RECORD,
+    LATENCY_STAGE_REPORT_SEND,
+    LATENCY_STAGE_TOTAL,
+    LATENCY_STAGE_COUNT,
+} latency_stage_t;
+
+/** @brief Discards all recorded samples and in-flight events. */
+void latency_trace_clear(void);
+
+/** @brief Retrieves the probe holding the samples of the supplied stage. */
+const profiling_probe_t *latency_trace_get_probe(latency_stage_t stage);
+
+/** @brief Returns the human-readable name of the supplied stage. */
+const char *latency_trace_stage_name(latency_stage_t stage);
+
+/** @brief Dumps all stages to the console. */
+void latency_trace_print(void);
+
+/**
+ * @brief Serialises the samples of a stage into a raw HID packet.
+ *
+ * Request layout, as sent by the host:
+ *     data[0]: command id, left untouched
+ *     data[1]: latency_stage_t to dump
+ *     data[2]: index of the first histogram bucket to return
+ *
+ * The response layout is that of profiling_probe_raw_hid_fill().
+ *
+ * @return false if the requested stage is invalid
+ */
+bool latency_trace_raw_hid_fill(uint8_t *data, uint8_t length);
+
+// Hooks called by the core -- not intended to be called from user code.
+void latency_trace_matrix_raw_change(void);
+void latency_trace_matrix_changed(void);
+void latency_trace_key_event(keyevent_t event);
+void latency_trace_record_begin(keyevent_t event);
+void latency_trace_record_end(keyevent_t event);
+void latency_trace_report_begin(void);
+void latency_trace_report_end(void);
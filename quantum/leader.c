@@ -3,10 +3,16 @@
 
 #include "leader.h"
 #include "timer.h"
+#include "deadline.h"
 #include "util.h"
 
 #include <string.h>
 
+#if __has_include("leader_data.h")
+#    include "progmem.h"
+#    include "leader_data.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
@@ -17,6 +23,58 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+#ifdef LEADER_DATA_SIZE
+// Node of leader_data[] reached by the keys typed so far
+#    define LEADER_NODE_NONE UINT16_MAX
+#    define LEADER_NODE_ACTION 0x8000
+#    define LEADER_NODE_CHILDREN 0x7FFF
+
+static uint16_t leader_node = LEADER_NODE_NONE;
+
+/**
+ * \brief Follows the edge for a keycode from the current node of the sequence trie.
+ */
+static void leader_trie_step(uint16_t keycode) {
+    if (leader_node == LEADER_NODE_NONE) {
+        return;
+    }
+
+    uint16_t header = pgm_read_word(&leader_data[leader_node]);
+    uint16_t edge   = leader_node + ((header & LEADER_NODE_ACTION) ? 2 : 1);
+    for (uint16_t i = 0; i < (header & LEADER_NODE_CHILDREN); i++, edge += 2) {
+        if (pgm_read_word(&leader_data[edge]) == keycode) {
+            leader_node = pgm_read_word(&leader_data[edge + 1]);
+            return;
+        }
+    }
+    leader_node = LEADER_NODE_NONE;
+}
+
+#    ifndef LEADER_DATA_NO_EARLY_FIRE
+/**
+ * \brief Whether the keys typed so far can only complete one sequence.
+ */
+static bool leader_trie_unambiguous(void) {
+    return leader_node != LEADER_NODE_NONE && pgm_read_word(&leader_data[leader_node]) == LEADER_NODE_ACTION;
+}
+#    endif
+
+/**
+ * \brief Runs the action of the sequence typed so far, if there is one.
+ */
+static void leader_trie_finish(void) {
+    if (leader_node == LEADER_NODE_NONE) {
+        return;
+    }
+
+    uint16_t node = leader_node;
+    leader_node   = LEADER_NODE_NONE;
+    if (pgm_read_word(&leader_data[node]) & LEADER_NODE_ACTION) {
+        leader_data_action(pgm_read_word(&leader_data[node + 1]));
+    }
+}
+#endif
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -34,10 +92,16 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#ifdef LEADER_DATA_SIZE
+    leader_node = 0;
+#endif
 }
 
 void leader_end(void) {
     leading = false;
+#ifdef LEADER_DATA_SIZE
+    leader_trie_finish();
+#endif
     leader_end_user();
 }
 
@@ -47,6 +111,19 @@ void leader_task(void) {
     }
 }
 
+bool leader_next_deadline(uint32_t *deadline) {
+    if (!leader_sequence_active()) {
+        return false;
+    }
+#if defined(LEADER_NO_TIMEOUT)
+    if (leader_sequence_size == 0) {
+        return false;
+    }
+#endif
+    *deadline = deadline_from_timer16(leader_time + LEADER_TIMEOUT + 1);
+    return true;
+}
+
 bool leader_sequence_active(void) {
     return leading;
 }
@@ -65,9 +142,19 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
+#ifdef LEADER_DATA_SIZE
+    leader_trie_step(keycode);
+#endif
+
     if (leader_add_user(keycode)) {
         leader_end();
     }
+#if defined(LEADER_DATA_SIZE) && !defined(LEADER_DATA_NO_EARLY_FIRE)
+    else if (leader_trie_unambiguous()) {
+        // Nothing longer can match, no need to wait for the timeout
+        leader_end();
+    }
+#endif
     return true;
 }
 
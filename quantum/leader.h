@@ -42,6 +42,14 @@ void leader_end(void);
 
 void leader_task(void);
 
+/**
+ * \brief Retrieves the time at which the leader sequence times out.
+ *
+ * \param deadline[out] the deadline in the timer_read32() time-space, which may already have passed
+ * \return true if a leader sequence is waiting for its timeout, otherwise false and deadline is left untouched
+ */
+bool leader_next_deadline(uint32_t *deadline);
+
 /**
  * Whether the leader sequence is active.
  */
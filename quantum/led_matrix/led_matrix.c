@@ -83,6 +83,27 @@ static uint32_t led_timer_buffer;
 static last_hit_t last_hit_buffer;
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef LED_MATRIX_FRAME_SKIP
+// frame skipping: every value written while drawing a frame is folded into a hash,
+// so a frame identical to the last one can go unflushed, or for static effects unrendered
+typedef enum { LED_FRAME_IDLE, LED_FRAME_EFFECT, LED_FRAME_INDICATORS, LED_FRAME_PROBE, LED_FRAME_FLUSH } led_frame_stage_t;
+
+static struct {
+    led_frame_stage_t stage;
+    bool              in_sync; // the LEDs show the last frame, with nothing written since
+    uint32_t          hash;
+    uint32_t          indicator_hash;
+    uint32_t          last_hash;
+    uint32_t          last_indicator_hash;
+    uint8_t           last_iter;
+    led_eeconfig_t    last_config;
+} led_frame;
+
+#    define LED_FRAME_STAGE(s) led_frame.stage = (s)
+#else
+#    define LED_FRAME_STAGE(s)
+#endif // LED_MATRIX_FRAME_SKIP
+
 // split led matrix
 #if defined(LED_MATRIX_SPLIT)
 const uint8_t k_led_matrix_split[2] = LED_MATRIX_SPLIT;
@@ -154,7 +175,42 @@ __attribute__((weak)) int led_matrix_led_index(int index) {
     return index;
 }
 
+#ifdef LED_MATRIX_FRAME_SKIP
+static uint32_t led_frame_mix(uint8_t index, uint8_t value) {
+    // The extra bit keeps the mix of every write non-zero, so even LED 0 set to 0 is seen by the sum
+    uint32_t x = (1UL << 16) | ((uint32_t)index << 8) | value;
+    // Bijective, so changing any single write always changes the sum
+    x ^= x >> 16;
+    x *= 0x45D9F3B;
+    x ^= x >> 16;
+    return x;
+}
+
+// Returns false if the value should not reach the driver
+static bool led_frame_record(uint8_t index, uint8_t value) {
+    if (led_frame.stage == LED_FRAME_IDLE) {
+        // Written from outside a frame, e.g. a keymap; the next frame must be flushed
+        led_frame.in_sync = false;
+        return true;
+    }
+
+    // Summed rather than chained, as indicator slices may be drawn in a different order
+    uint32_t mix = led_frame_mix(index, value);
+    if (led_frame.stage != LED_FRAME_EFFECT) {
+        led_frame.indicator_hash += mix;
+    }
+    if (led_frame.stage == LED_FRAME_PROBE) {
+        return false;
+    }
+    led_frame.hash += mix;
+    return true;
+}
+#endif // LED_MATRIX_FRAME_SKIP
+
 void led_matrix_set_value(int index, uint8_t value) {
+#ifdef LED_MATRIX_FRAME_SKIP
+    if (!led_frame_record(index, value)) return;
+#endif
 #ifdef USE_CIE1931_CURVE
     value = pgm_read_byte(&CIE1931_CURVE[value]);
 #endif
@@ -166,6 +222,9 @@ void led_matrix_set_value_all(uint8_t value) {
     for (uint8_t i = 0; i < LED_MATRIX_LED_COUNT; i++)
         led_matrix_set_value(i, value);
 #else
+#    ifdef LED_MATRIX_FRAME_SKIP
+    if (!led_frame_record(NO_LED, value)) return;
+#    endif
 #    ifdef USE_CIE1931_CURVE
     led_matrix_driver.set_value_all(pgm_read_byte(&CIE1931_CURVE[value]));
 #    else
@@ -251,7 +310,48 @@ static void led_task_sync(void) {
     if (sync_timer_elapsed32(g_led_timer) >= LED_MATRIX_LED_FLUSH_LIMIT) led_task_state = STARTING;
 }
 
-static void led_task_start(void) {
+#ifdef LED_MATRIX_FRAME_SKIP
+// Effects whose output depends on nothing but led_matrix_eeconfig and g_led_config,
+// a keymap may override this to add its own
+__attribute__((weak)) bool led_matrix_effect_is_static(uint8_t mode) {
+    return mode == LED_MATRIX_SOLID;
+}
+
+static bool led_frame_is_unchanged(uint8_t effect) {
+    if (!led_frame.in_sync || !led_matrix_effect_is_static(effect) || effect != led_last_effect || led_matrix_eeconfig.enable != led_last_enable || led_matrix_eeconfig.raw != led_frame.last_config.raw) {
+        return false;
+    }
+
+    // The effect would draw the same values again, but the indicators may not:
+    // draw them into the hash only, slice by slice as the last frame did
+    effect_params_t params = led_effect_params;
+
+    led_frame.indicator_hash = 0;
+    LED_FRAME_STAGE(LED_FRAME_PROBE);
+    led_matrix_indicators();
+    for (params.iter = 1; params.iter <= led_frame.last_iter; params.iter++) {
+        led_matrix_indicators_advanced(&params);
+    }
+    LED_FRAME_STAGE(LED_FRAME_IDLE);
+
+    return led_frame.indicator_hash == led_frame.last_indicator_hash;
+}
+
+// Returns true if the frame just drawn matches the one the LEDs already show
+static bool led_frame_end(void) {
+    bool unchanged = led_frame.stage == LED_FRAME_FLUSH && led_frame.in_sync && led_frame.hash == led_frame.last_hash;
+
+    // A flush from outside led_matrix_task(), e.g. on suspend, leaves the LEDs in a state no hash describes
+    led_frame.in_sync             = led_frame.stage == LED_FRAME_FLUSH;
+    led_frame.last_hash           = led_frame.hash;
+    led_frame.last_indicator_hash = led_frame.indicator_hash;
+    led_frame.last_iter           = led_effect_params.iter;
+    led_frame.last_config         = led_matrix_eeconfig;
+    return unchanged;
+}
+#endif // LED_MATRIX_FRAME_SKIP
+
+static void led_task_start(uint8_t effect) {
     // reset iter
     led_effect_params.iter = 0;
 
@@ -261,6 +361,15 @@ static void led_task_start(void) {
     g_last_hit_tracker = last_hit_buffer;
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef LED_MATRIX_FRAME_SKIP
+    if (led_frame_is_unchanged(effect)) {
+        led_task_state = SYNCING;
+        return;
+    }
+    led_frame.hash           = 0;
+    led_frame.indicator_hash = 0;
+#endif // LED_MATRIX_FRAME_SKIP
+
     // next task
     led_task_state = RENDERING;
 }
@@ -332,8 +441,11 @@ static void led_task_flush(uint8_t effect) {
     led_last_effect = effect;
     led_last_enable = led_matrix_eeconfig.enable;
 
-    // update pwm buffers
-    led_matrix_update_pwm_buffers();
+    // update pwm buffers, unless nothing changed since the last frame
+#ifdef LED_MATRIX_FRAME_SKIP
+    if (!led_frame_end())
+#endif
+        led_matrix_update_pwm_buffers();
 
     // next task
     led_task_state = SYNCING;
@@ -354,19 +466,24 @@ void led_matrix_task(void) {
 
     switch (led_task_state) {
         case STARTING:
-            led_task_start();
+            led_task_start(effect);
             break;
         case RENDERING:
+            LED_FRAME_STAGE(LED_FRAME_EFFECT);
             led_task_render(effect);
             if (effect) {
+                LED_FRAME_STAGE(LED_FRAME_INDICATORS);
                 if (led_task_state == FLUSHING) {
                     led_matrix_indicators(); // ensure we only draw basic indicators once rendering is finished
                 }
                 led_matrix_indicators_advanced(&led_effect_params);
             }
+            LED_FRAME_STAGE(LED_FRAME_IDLE);
             break;
         case FLUSHING:
+            LED_FRAME_STAGE(LED_FRAME_FLUSH);
             led_task_flush(effect);
+            LED_FRAME_STAGE(LED_FRAME_IDLE);
             break;
         case SYNCING:
             led_task_sync();
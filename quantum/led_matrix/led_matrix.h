@@ -146,6 +146,11 @@ void led_matrix_indicators_advanced(effect_params_t *params);
 bool led_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 bool led_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
+#ifdef LED_MATRIX_FRAME_SKIP
+// Whether an effect draws the same frame for as long as led_matrix_eeconfig is unchanged
+bool led_matrix_effect_is_static(uint8_t mode);
+#endif
+
 void led_matrix_init(void);
 
 void led_matrix_reload_from_eeprom(void);
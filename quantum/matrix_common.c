@@ -10,6 +10,10 @@
 #    include <string.h>
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 #ifndef MATRIX_IO_DELAY
 #    define MATRIX_IO_DELAY 30
 #endif
@@ -163,6 +167,9 @@ __attribute__((weak)) void matrix_init(void) {
 
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
+#ifdef LATENCY_TRACE_ENABLE
+    if (changed) latency_trace_matrix_raw_change();
+#endif
 
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, MATRIX_ROWS_PER_HAND, changed) | matrix_post_scan();
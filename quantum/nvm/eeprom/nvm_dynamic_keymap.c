@@ -1,6 +1,8 @@
 // Copyright 2024 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
+
 #include "compiler_support.h"
 #include "keycodes.h"
 #include "eeprom.h"
@@ -155,17 +157,17 @@ uint32_t nvm_dynamic_keymap_macro_size(void) {
 }
 
 void nvm_dynamic_keymap_macro_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
+    // Read the part within the macro buffer as one block, so external
+    // EEPROMs can service it with a single bus transaction
+    uint32_t valid = 0;
+    if (offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
+        valid = DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset;
+        if (valid > size) {
+            valid = size;
         }
-        source++;
-        target++;
+        eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), valid);
     }
+    memset(data + valid, 0x00, size - valid);
 }
 
 void nvm_dynamic_keymap_macro_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
@@ -18,6 +18,7 @@
 #include "quantum.h"
 #include "action_util.h"
 #include "timer.h"
+#include "deadline.h"
 #include "keycodes.h"
 
 #ifndef AUTO_SHIFT_DISABLED_AT_STARTUP
@@ -321,6 +322,24 @@ void autoshift_matrix_scan(void) {
     }
 }
 
+/** \brief Retrieves the time at which autoshift_matrix_scan() will shift the pending key
+ *
+ *  \return true if an auto-shiftable key is waiting for its timeout
+ */
+bool autoshift_next_deadline(uint32_t *deadline) {
+    if (!autoshift_flags.in_progress) {
+        return false;
+    }
+    *deadline = deadline_from_timer16(autoshift_time +
+#ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+                                      get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
+#else
+                                      autoshift_timeout
+#endif
+    );
+    return true;
+}
+
 void autoshift_toggle(void) {
     autoshift_flags.enabled = !autoshift_flags.enabled;
     autoshift_flush_shift();
@@ -55,6 +55,7 @@ uint16_t get_generic_autoshift_timeout(void);
 uint16_t (get_autoshift_timeout)(uint16_t keycode, keyrecord_t *record);
 void     set_autoshift_timeout(uint16_t timeout);
 void     autoshift_matrix_scan(void);
+bool     autoshift_next_deadline(uint32_t *deadline);
 bool     get_custom_auto_shifted_key(uint16_t keycode, keyrecord_t *record);
 bool     get_auto_shifted_key(uint16_t keycode, keyrecord_t *record);
 // clang-format on
@@ -12,12 +12,159 @@
 #include "send_string.h"
 #include "action_util.h"
 
-#if __has_include("autocorrect_data.h")
-#    include "autocorrect_data.h"
+#ifdef AUTOCORRECT_EXTERNAL_FLASH
+#    include "flash.h"
+#    include "debug.h"
+
+#    ifndef FLASH_ENABLE
+#        error "AUTOCORRECT_EXTERNAL_FLASH requires a FLASH_DRIVER"
+#    endif
+// Corrections are handed to apply_autocorrect() from a RAM buffer, which is only a valid PROGMEM string where PROGMEM
+// is ordinary memory
+#    if defined(__AVR__)
+#        error "AUTOCORRECT_EXTERNAL_FLASH is not supported on AVR"
+#    endif
+// Where `qmk generate-autocorrect-data --external` output was written to
+#    ifndef AUTOCORRECT_EXTERNAL_FLASH_ADDRESS
+#        define AUTOCORRECT_EXTERNAL_FLASH_ADDRESS 0
+#    endif
+// Longest typo the dictionary may contain
+#    ifndef AUTOCORRECT_MAX_LENGTH
+#        define AUTOCORRECT_MAX_LENGTH 32
+#    endif
+// Longest correction the dictionary may contain
+#    ifndef AUTOCORRECT_MAX_CORRECTION_LENGTH
+#        define AUTOCORRECT_MAX_CORRECTION_LENGTH 32
+#    endif
+// Number and size of the RAM cache lines holding recently read trie nodes
+#    ifndef AUTOCORRECT_CACHE_LINES
+#        define AUTOCORRECT_CACHE_LINES 8
+#    endif
+#    ifndef AUTOCORRECT_CACHE_LINE_SIZE
+#        define AUTOCORRECT_CACHE_LINE_SIZE 32
+#    endif
+
+/* The dictionary starts with a header:
+ *
+ *     'Q' 'A' 'C' version link_size min_length max_length max_correction_length [size, 32-bit little endian]
+ *
+ * followed by the trie, with links of `link_size` bytes.
+ */
+#    define AUTOCORRECT_FLASH_VERSION 2
+#    define AUTOCORRECT_FLASH_HEADER_SIZE 12
+
+typedef uint32_t autocorrect_offset_t;
+
+typedef struct {
+    uint32_t line; // index of the line in the dictionary, plus one, or 0 when unused
+    uint8_t  age;
+    uint8_t  data[AUTOCORRECT_CACHE_LINE_SIZE];
+} autocorrect_cache_line_t;
+
+static autocorrect_cache_line_t autocorrect_cache[AUTOCORRECT_CACHE_LINES];
+
+static bool     autocorrect_loaded     = false;
+static uint32_t autocorrect_dict_size  = 0; // 0 when no valid dictionary was found
+static uint8_t  autocorrect_link_size  = 2;
+static uint8_t  autocorrect_min_length = 1;
+
+#    define DICTIONARY_SIZE autocorrect_dict_size
+#    define AUTOCORRECT_MIN_LENGTH autocorrect_min_length
+
+/**
+ * @brief Reads and validates the dictionary header from external flash
+ */
+static void autocorrect_load(void) {
+    uint8_t header[AUTOCORRECT_FLASH_HEADER_SIZE];
+
+    autocorrect_loaded    = true;
+    autocorrect_dict_size = 0;
+    for (uint8_t i = 0; i < AUTOCORRECT_CACHE_LINES; i++) {
+        autocorrect_cache[i].line = 0;
+        autocorrect_cache[i].age  = UINT8_MAX;
+    }
+
+    flash_init();
+    if (flash_read_range(AUTOCORRECT_EXTERNAL_FLASH_ADDRESS, header, sizeof(header)) != FLASH_STATUS_SUCCESS) {
+        dprintln("autocorrect: failed to read dictionary header");
+        return;
+    }
+    if (header[0] != 'Q' || header[1] != 'A' || header[2] != 'C' || header[3] != AUTOCORRECT_FLASH_VERSION) {
+        dprintln("autocorrect: no dictionary in external flash");
+        return;
+    }
+    if ((header[4] != 2 && header[4] != 3) || header[5] == 0 || header[6] > AUTOCORRECT_MAX_LENGTH || header[7] > AUTOCORRECT_MAX_CORRECTION_LENGTH) {
+        dprintf("autocorrect: unsupported dictionary, typos up to %u chars and corrections up to %u chars supported\n", AUTOCORRECT_MAX_LENGTH, AUTOCORRECT_MAX_CORRECTION_LENGTH);
+        return;
+    }
+
+    autocorrect_link_size  = header[4];
+    autocorrect_min_length = header[5];
+    autocorrect_dict_size  = header[8] | (uint32_t)header[9] << 8 | (uint32_t)header[10] << 16 | (uint32_t)header[11] << 24;
+}
+
+/**
+ * @brief Reads a byte of the trie, through the cache
+ */
+static uint8_t autocorrect_read_byte(autocorrect_offset_t offset) {
+    uint32_t                  line   = offset / AUTOCORRECT_CACHE_LINE_SIZE + 1;
+    autocorrect_cache_line_t *found  = NULL;
+    autocorrect_cache_line_t *victim = &autocorrect_cache[0];
+
+    for (uint8_t i = 0; i < AUTOCORRECT_CACHE_LINES; i++) {
+        autocorrect_cache_line_t *entry = &autocorrect_cache[i];
+        if (entry->line == line) {
+            found = entry;
+        } else if (entry->age < UINT8_MAX) {
+            entry->age++;
+        }
+        if (entry->age > victim->age) {
+            victim = entry;
+        }
+    }
+
+    if (!found) {
+        // Replace the least recently used line
+        found = victim;
+        if (flash_read_range(AUTOCORRECT_EXTERNAL_FLASH_ADDRESS + AUTOCORRECT_FLASH_HEADER_SIZE + (line - 1) * AUTOCORRECT_CACHE_LINE_SIZE, found->data, AUTOCORRECT_CACHE_LINE_SIZE) != FLASH_STATUS_SUCCESS) {
+            found->line = 0;
+            found->age  = UINT8_MAX;
+            return 0;
+        }
+        found->line = line;
+    }
+    found->age = 0;
+    return found->data[offset % AUTOCORRECT_CACHE_LINE_SIZE];
+}
 #else
-#    pragma message "Autocorrect is using the default library."
-#    include "autocorrect_data_default.h"
+#    if __has_include("autocorrect_data.h")
+#        include "autocorrect_data.h"
+#    else
+#        pragma message "Autocorrect is using the default library."
+#        include "autocorrect_data_default.h"
+#    endif
+
+typedef uint16_t autocorrect_offset_t;
+
+#    define autocorrect_link_size 2
+
+static inline uint8_t autocorrect_read_byte(autocorrect_offset_t offset) {
+    return pgm_read_byte(autocorrect_data + offset);
+}
+#endif
+
+/**
+ * @brief Reads the link to a child node
+ */
+static autocorrect_offset_t autocorrect_read_link(autocorrect_offset_t offset) {
+    autocorrect_offset_t link = autocorrect_read_byte(offset) | autocorrect_read_byte(offset + 1) << 8;
+#ifdef AUTOCORRECT_EXTERNAL_FLASH
+    if (autocorrect_link_size > 2) {
+        link |= (uint32_t)autocorrect_read_byte(offset + 2) << 16;
+    }
 #endif
+    return link;
+}
 
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
@@ -222,6 +369,15 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         return true;
     }
 
+#ifdef AUTOCORRECT_EXTERNAL_FLASH
+    if (!autocorrect_loaded) {
+        autocorrect_load();
+    }
+    if (autocorrect_dict_size == 0) {
+        return true;
+    }
+#endif
+
     if (!record->event.pressed) {
         return true;
     }
@@ -280,22 +436,22 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    autocorrect_offset_t state = 0;
+    uint8_t              code  = autocorrect_read_byte(state);
     for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
         uint8_t const key_i = typo_buffer[i];
 
         if (code & 64) { // Check for match in node with multiple children.
             code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+            for (; code != key_i; code = autocorrect_read_byte(state += 1 + autocorrect_link_size)) {
                 if (!code) return true;
             }
             // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            state = autocorrect_read_link(state + 1);
             // Check for match in node with single child.
         } else if (code != key_i) {
             return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+        } else if (!(code = autocorrect_read_byte(++state))) {
             ++state;
         }
 
@@ -305,11 +461,22 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             return true;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
+        code = autocorrect_read_byte(state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
             const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
+#ifdef AUTOCORRECT_EXTERNAL_FLASH
+            // Bring the correction into RAM, which still satisfies the PROGMEM contract of apply_autocorrect().
+            // autocorrect_load() only accepts dictionaries whose corrections fit.
+            char changes[AUTOCORRECT_MAX_CORRECTION_LENGTH + 1] = {0};
+            for (uint8_t c = 0; c < sizeof(changes) - 1; ++c) {
+                if (!(changes[c] = autocorrect_read_byte(state + 1 + c))) {
+                    break;
+                }
+            }
+#else
+            const char *changes = (const char *)(autocorrect_data + state + 1);
+#endif
 
             /* Gather info about the typo'd word
              *
@@ -349,7 +516,12 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
              *
              * B) When correcting 'typo' -- Need extra offset for terminator
              */
+#ifdef AUTOCORRECT_EXTERNAL_FLASH
+            // The correction is written after at most the whole typo
+            char correct[AUTOCORRECT_MAX_LENGTH + AUTOCORRECT_MAX_CORRECTION_LENGTH + 1] = {0};
+#else
             char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+#endif
 
             uint8_t offset = space_last ? backspaces : backspaces + 1;
             strcpy(correct, typo);
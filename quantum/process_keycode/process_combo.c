@@ -16,9 +16,11 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
+#include "deadline.h"
 #include "wait.h"
 #include "keyboard.h"
 #include "keymap_common.h"
@@ -199,14 +201,31 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
     return COMBO_TERM;
 }
 
+#ifdef COMBO_KEY_INDEX
+/* Set whenever a key event touched combo state, so clear_combos() can skip
+ * walking every combo after events which matched none of them. */
+static bool combo_state_dirty = true;
+#endif
+
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_KEY_INDEX
+    if (!combo_state_dirty) {
+        return;
+    }
+    combo_state_dirty = false;
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
             RESET_COMBO_STATE(combo);
         }
+#ifdef COMBO_KEY_INDEX
+        else {
+            combo_state_dirty = true;
+        }
+#endif
     }
 }
 
@@ -264,7 +283,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -551,9 +569,70 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
     return key_is_part_of_combo ? COMBO_KEY_PRESSED : COMBO_KEY_NOT_PRESSED;
 }
 
+#ifdef COMBO_KEY_INDEX
+/* Each bucket holds a bitset of the combos containing at least one keycode
+ * which hashes into that bucket, so a key event only needs to visit those
+ * combos instead of every combo in the keymap. */
+static uint16_t combo_key_index_count = 0;
+static bool     combo_key_index_valid = false;
+
+void combo_key_index_invalidate(void) {
+    combo_key_index_valid = false;
+    combo_state_dirty     = true;
+}
+
+static bool combo_key_index_build(void) {
+    uint16_t count = combo_count();
+    if (combo_key_index_valid && combo_key_index_count == count) {
+        return true;
+    }
+
+    /* Storage is sized for the combos compiled into the keymap. */
+    if (count > combo_count_raw()) {
+        return false;
+    }
+
+    uint16_t stride = (combo_count_raw() + 7) / 8;
+    uint8_t *index  = combo_key_index_storage();
+    memset(index, 0, COMBO_KEY_INDEX_BUCKETS * stride);
+    for (uint16_t idx = 0; idx < count; ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        for (uint8_t i = 0;; ++i) {
+            uint16_t key = pgm_read_word(&keys[i]);
+            if (COMBO_END == key) break;
+            index[COMBO_KEY_INDEX_BUCKET(key) * stride + idx / 8] |= 1 << (idx % 8);
+        }
+    }
+
+    combo_key_index_count = count;
+    combo_key_index_valid = true;
+    combo_state_dirty     = true;
+    return true;
+}
+
+static uint8_t process_indexed_combos(uint16_t keycode, keyrecord_t *record) {
+    uint8_t        is_combo_key = COMBO_KEY_NOT_PRESSED;
+    uint16_t       stride       = (combo_count_raw() + 7) / 8;
+    const uint8_t *bucket       = combo_key_index_storage() + COMBO_KEY_INDEX_BUCKET(keycode) * stride;
+
+    /* Visit candidates in ascending order, matching the linear scan. */
+    for (uint16_t byte = 0; byte < stride; ++byte) {
+        uint8_t bits = bucket[byte];
+        while (bits) {
+            uint8_t  bit = __builtin_ctz(bits);
+            uint16_t idx = byte * 8 + bit;
+            bits &= bits - 1;
+            if (idx < combo_key_index_count) {
+                is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+            }
+        }
+    }
+    return is_combo_key;
+}
+#endif
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +660,19 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX
+    if (combo_key_index_build()) {
+        is_combo_key = process_indexed_combos(keycode, record);
+        combo_state_dirty |= is_combo_key != COMBO_KEY_NOT_PRESSED;
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+#ifdef COMBO_KEY_INDEX
+        combo_state_dirty = true;
+#endif
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -647,6 +735,16 @@ void combo_task(void) {
 #endif
 }
 
+bool combo_next_deadline(uint32_t *deadline) {
+#ifndef COMBO_NO_TIMER
+    if (b_combo_enable && timer) {
+        *deadline = deadline_from_timer16(timer + longest_term + 1);
+        return true;
+    }
+#endif
+    return false;
+}
+
 void combo_enable(void) {
     b_combo_enable = true;
 }
@@ -38,6 +38,15 @@
 #ifndef COMBO_BUFFER_LENGTH
 #    define COMBO_BUFFER_LENGTH 4
 #endif
+#ifdef COMBO_KEY_INDEX
+#    ifndef COMBO_KEY_INDEX_BUCKETS
+#        define COMBO_KEY_INDEX_BUCKETS 32
+#    endif
+#    if (COMBO_KEY_INDEX_BUCKETS & (COMBO_KEY_INDEX_BUCKETS - 1)) != 0
+#        error COMBO_KEY_INDEX_BUCKETS must be a power of two
+#    endif
+#    define COMBO_KEY_INDEX_BUCKET(keycode) (((keycode) ^ ((keycode) >> 8)) & (COMBO_KEY_INDEX_BUCKETS - 1))
+#endif
 
 typedef struct combo_t {
     const uint16_t *keys;
@@ -75,8 +84,19 @@ typedef struct combo_t {
 
 bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
+/** \brief Retrieves the time at which combo_task() next needs to run.
+ *
+ * \param deadline[out] the deadline in the timer_read32() time-space, which may already have passed
+ * \return true if a combo term is running, otherwise false and deadline is left untouched
+ */
+bool combo_next_deadline(uint32_t *deadline);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
+#ifdef COMBO_KEY_INDEX
+/* Forces the keycode to combo index to be rebuilt, e.g. after changing combo definitions at runtime. */
+void combo_key_index_invalidate(void);
+#endif
+
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
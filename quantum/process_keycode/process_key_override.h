@@ -105,6 +105,22 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+#ifdef KEY_OVERRIDE_INDEX
+#    ifndef KEY_OVERRIDE_INDEX_BUCKETS
+#        define KEY_OVERRIDE_INDEX_BUCKETS 16
+#    endif
+#    if (KEY_OVERRIDE_INDEX_BUCKETS & (KEY_OVERRIDE_INDEX_BUCKETS - 1)) != 0
+#        error KEY_OVERRIDE_INDEX_BUCKETS must be a power of two
+#    endif
+/** Overrides triggered by KC_NO are bucketed by their required modifiers, ignoring the side. */
+#    define KEY_OVERRIDE_INDEX_MOD_BUCKETS 16
+#    define KEY_OVERRIDE_INDEX_TRIGGER_BUCKET(keycode) (((keycode) ^ ((keycode) >> 8)) & (KEY_OVERRIDE_INDEX_BUCKETS - 1))
+#    define KEY_OVERRIDE_INDEX_MOD_BUCKET(mods) (KEY_OVERRIDE_INDEX_BUCKETS + (((mods) | ((mods) >> 4)) & 0x0F))
+
+/** Forces the trigger index to be rebuilt, e.g. after changing key override definitions at runtime */
+void key_override_index_invalidate(void);
+#endif
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
@@ -20,6 +20,7 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "timer.h"
+#include "deadline.h"
 #include "wait.h"
 #include "keymap_introspection.h"
 
@@ -194,6 +195,14 @@ void tap_dance_task(void) {
     }
 }
 
+bool tap_dance_next_deadline(uint32_t *deadline) {
+    if (!active_td) {
+        return false;
+    }
+    *deadline = deadline_from_timer16(last_tap_time + GET_TAPPING_TERM(active_td, &(keyrecord_t){}) + 1);
+    return true;
+}
+
 void reset_tap_dance(tap_dance_state_t *state) {
     active_td = 0;
     process_tap_dance_action_on_reset((tap_dance_action_t *)state);
@@ -85,6 +85,12 @@ void reset_tap_dance(tap_dance_state_t *state);
 bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record);
 bool process_tap_dance(uint16_t keycode, keyrecord_t *record);
 void tap_dance_task(void);
+/** \brief Retrieves the time at which tap_dance_task() next needs to run.
+ *
+ * \param deadline[out] the deadline in the timer_read32() time-space, which may already have passed
+ * \return true if a tap dance is waiting for its tapping term, otherwise false and deadline is left untouched
+ */
+bool tap_dance_next_deadline(uint32_t *deadline);
 
 void tap_dance_pair_on_each_tap(tap_dance_state_t *state, void *user_data);
 void tap_dance_pair_finished(tap_dance_state_t *state, void *user_data);
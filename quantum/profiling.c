@@ -0,0 +1,231 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "profiling.h"
+#include "timer.h"
+#include "print.h"
+
+__attribute__((weak)) uint32_t profiling_timestamp(void) {
+    return timer_read_stamp();
+}
+
+__attribute__((weak)) uint32_t profiling_elapsed(uint32_t start) {
+    return timer_stamp_elapsed_us(start);
+}
+
+static uint8_t bucket_for(uint32_t value) {
+    uint8_t bucket = 0;
+    while (value && bucket < (PROFILING_HISTOGRAM_BUCKETS - 1)) {
+        value >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+uint32_t profiling_bucket_floor(uint8_t bucket) {
+    return bucket == 0 ? 0 : (1UL << (bucket - 1));
+}
+
+void profiling_probe_add(profiling_probe_t *probe, uint32_t duration) {
+    if (probe->count == 0 || duration < probe->min) {
+        probe->min = duration;
+    }
+    if (duration > probe->max) {
+        probe->max = duration;
+    }
+    ++probe->count;
+    probe->sum += duration;
+
+    uint8_t bucket = bucket_for(duration);
+    if (probe->buckets[bucket] < UINT16_MAX) {
+        ++probe->buckets[bucket];
+    }
+}
+
+void profiling_probe_clear(profiling_probe_t *probe) {
+    probe->count = 0;
+    probe->min   = 0;
+    probe->max   = 0;
+    probe->sum   = 0;
+    memset(probe->buckets, 0, sizeof(probe->buckets));
+}
+
+uint32_t profiling_mean(const profiling_probe_t *probe) {
+    return probe->count ? (uint32_t)(probe->sum / probe->count) : 0;
+}
+
+uint32_t profiling_percentile(const profiling_probe_t *probe, uint8_t percentile) {
+    if (probe->count == 0) {
+        return 0;
+    }
+    if (percentile > 100) {
+        percentile = 100;
+    }
+
+    // Bucket counts saturate, so rank against their total rather than `count`
+    uint32_t total = 0;
+    for (uint8_t b = 0; b < PROFILING_HISTOGRAM_BUCKETS; b++) {
+        total += probe->buckets[b];
+    }
+    uint32_t rank = (total * percentile + 99) / 100;
+    if (rank == 0) {
+        return probe->min;
+    }
+
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < PROFILING_HISTOGRAM_BUCKETS; b++) {
+        seen += probe->buckets[b];
+        if (seen >= rank) {
+            if (b == PROFILING_HISTOGRAM_BUCKETS - 1) {
+                return probe->max;
+            }
+            uint32_t upper = b == 0 ? 0 : profiling_bucket_floor(b + 1) - 1;
+            if (upper < probe->min) {
+                return probe->min;
+            }
+            return upper > probe->max ? probe->max : upper;
+        }
+    }
+    return probe->max;
+}
+
+void profiling_probe_print(const char *prefix, const profiling_probe_t *probe) {
+    uprintf("%s %s: n=%lu min=%luus mean=%luus p50=%luus p90=%luus p99=%luus max=%luus\n", prefix, probe->name ? probe->name : "?", (unsigned long)probe->count, (unsigned long)probe->min, (unsigned long)profiling_mean(probe), (unsigned long)profiling_percentile(probe, 50), (unsigned long)profiling_percentile(probe, 90), (unsigned long)profiling_percentile(probe, 99), (unsigned long)probe->max);
+    for (uint8_t b = 0; b < PROFILING_HISTOGRAM_BUCKETS; b++) {
+        if (probe->buckets[b]) {
+            uprintf("  >=%luus: %u\n", (unsigned long)profiling_bucket_floor(b), probe->buckets[b]);
+        }
+    }
+}
+
+static void put_u32(uint8_t *dst, uint32_t value) {
+    dst[0] = value & 0xFF;
+    dst[1] = (value >> 8) & 0xFF;
+    dst[2] = (value >> 16) & 0xFF;
+    dst[3] = (value >> 24) & 0xFF;
+}
+
+bool profiling_probe_raw_hid_fill(const profiling_probe_t *probe, uint8_t *data, uint8_t length) {
+    if (length < 24) {
+        return false;
+    }
+
+    data[3] = PROFILING_HISTOGRAM_BUCKETS;
+    put_u32(&data[4], probe->count);
+    put_u32(&data[8], probe->min);
+    put_u32(&data[12], probe->max);
+    put_u32(&data[16], profiling_mean(probe));
+    put_u32(&data[20], profiling_percentile(probe, 99));
+
+    uint8_t offset = 24;
+    for (uint8_t b = data[2]; b < PROFILING_HISTOGRAM_BUCKETS && offset + 2 <= length; b++, offset += 2) {
+        data[offset]     = probe->buckets[b] & 0xFF;
+        data[offset + 1] = probe->buckets[b] >> 8;
+    }
+    memset(&data[offset], 0, length - offset);
+    return true;
+}
+
+#ifdef PROFILING_ENABLE
+static profiling_probe_t *probes = NULL;
+
+// Sorted slowest first
+static profiling_sample_t slowest[PROFILING_SLOW_SAMPLES];
+static uint8_t            slowest_count = 0;
+
+static void register_probe(profiling_probe_t *probe) {
+    profiling_probe_t **link = &probes;
+    while (*link) {
+        link = &(*link)->next;
+    }
+    probe->next       = NULL;
+    probe->registered = true;
+    *link             = probe;
+}
+
+static void record_slow_sample(const profiling_probe_t *probe, uint32_t duration) {
+    if (slowest_count == PROFILING_SLOW_SAMPLES && duration <= slowest[PROFILING_SLOW_SAMPLES - 1].duration) {
+        return;
+    }
+
+    uint8_t i = slowest_count < PROFILING_SLOW_SAMPLES ? slowest_count++ : PROFILING_SLOW_SAMPLES - 1;
+    // Ties keep the earlier sample ahead
+    while (i > 0 && slowest[i - 1].duration < duration) {
+        slowest[i] = slowest[i - 1];
+        --i;
+    }
+    slowest[i].probe    = probe;
+    slowest[i].duration = duration;
+    slowest[i].time     = timer_read32();
+}
+
+void profiling_record(profiling_probe_t *probe, uint32_t duration) {
+    if (!probe->registered) {
+        register_probe(probe);
+    }
+    profiling_probe_add(probe, duration);
+    record_slow_sample(probe, duration);
+}
+
+profiling_probe_t *profiling_probes(void) {
+    return probes;
+}
+
+profiling_probe_t *profiling_find(const char *name) {
+    for (profiling_probe_t *probe = probes; probe; probe = probe->next) {
+        if (probe->name && strcmp(probe->name, name) == 0) {
+            return probe;
+        }
+    }
+    return NULL;
+}
+
+const profiling_sample_t *profiling_slowest(uint8_t index) {
+    return index < slowest_count ? &slowest[index] : NULL;
+}
+
+void profiling_clear(void) {
+    for (profiling_probe_t *probe = probes; probe; probe = probe->next) {
+        profiling_probe_clear(probe);
+    }
+    memset(slowest, 0, sizeof(slowest));
+    slowest_count = 0;
+}
+
+void profiling_print(void) {
+    for (profiling_probe_t *probe = probes; probe; probe = probe->next) {
+        profiling_probe_print("profile", probe);
+    }
+    for (uint8_t i = 0; i < slowest_count; i++) {
+        uprintf("slowest %u: %s %luus at %lums\n", i, slowest[i].probe->name ? slowest[i].probe->name : "?", (unsigned long)slowest[i].duration, (unsigned long)slowest[i].time);
+    }
+}
+
+bool profiling_raw_hid_fill(uint8_t *data, uint8_t length) {
+    if (length < 24) {
+        return false;
+    }
+    profiling_probe_t *probe = probes;
+    for (uint8_t i = 0; probe && i < data[1]; i++) {
+        probe = probe->next;
+    }
+    if (!probe) {
+        return false;
+    }
+
+    if (data[2] == 0xFF) {
+        memset(&data[3], 0, length - 3);
+        if (probe->name) {
+            strncpy((char *)&data[3], probe->name, length - 4);
+        }
+        return true;
+    }
+    return profiling_probe_raw_hid_fill(probe, data, length);
+}
+#else
+// Nothing to register with, only the statistics of the probe are kept
+void profiling_record(profiling_probe_t *probe, uint32_t duration) {
+    profiling_probe_add(probe, duration);
+}
+#endif
@@ -0,0 +1,201 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/*
+    This API records run time statistics for named sections of code, on every
+    platform including the host test platform.
+
+    Each probe accumulates the sample count, minimum, maximum and mean, along
+    with a log2 histogram from which percentiles are estimated. Additionally,
+    the slowest samples seen across all probes are retained together with the
+    time they occurred, so that rare spikes can be correlated with whatever
+    else was happening at the time.
+
+    Usage example:
+
+        #include "profiling.h"
+
+        static profiling_probe_t matrix_probe = PROFILING_PROBE("matrix");
+
+        // Original code:
+        matrix_task();
+
+        // Replace with:
+        PROFILE_BLOCK(matrix_probe, {
+            matrix_task();
+        });
+
+        // Or, for sections which do not fit in a block:
+        uint32_t start = profiling_begin();
+        matrix_task();
+        profiling_end(&matrix_probe, start);
+
+    Probes register themselves on their first sample. The results can be
+    dumped to the console with profiling_print(), or retrieved over raw HID
+    with profiling_raw_hid_fill().
+
+    Latency tracing and the task scheduler keep their statistics in probes
+    as well, so the profiling_probe_*() functions and the statistics below
+    are available whenever either of them is enabled, even without
+    PROFILING_ENABLE. Without it, probes are never registered and no slow
+    samples are kept.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @def Number of log2 buckets per histogram. Bucket `n` counts samples in the range [2^(n-1), 2^n - 1] microseconds, bucket 0 counts zero-length samples, and the final bucket also absorbs all larger samples.
+ */
+#ifndef PROFILING_HISTOGRAM_BUCKETS
+#    define PROFILING_HISTOGRAM_BUCKETS 20
+#endif
+
+/**
+ * @def Number of slowest samples retained across all probes.
+ */
+#ifndef PROFILING_SLOW_SAMPLES
+#    define PROFILING_SLOW_SAMPLES 8
+#endif
+
+typedef struct profiling_probe_t {
+    const char *name;
+
+    uint32_t count;
+    uint32_t min; // microseconds
+    uint32_t max; // microseconds
+    uint64_t sum; // microseconds
+    uint16_t buckets[PROFILING_HISTOGRAM_BUCKETS];
+
+    /* Internal state */
+    bool                      registered;
+    struct profiling_probe_t *next;
+} profiling_probe_t;
+
+typedef struct {
+    const profiling_probe_t *probe;
+    uint32_t                 duration; // microseconds
+    uint32_t                 time;     // timer_read32() at the end of the sample
+} profiling_sample_t;
+
+/** @brief Static initialiser for a probe with the supplied name. */
+#define PROFILING_PROBE(probe_name) \
+    { .name = (probe_name) }
+
+/**
+ * @brief Current timestamp, in platform specific units.
+ *
+ * Only meaningful as the `start` argument of profiling_elapsed() and profiling_end().
+ */
+uint32_t profiling_timestamp(void);
+
+/** @brief Microseconds elapsed since the supplied profiling_timestamp(). */
+uint32_t profiling_elapsed(uint32_t start);
+
+/** @brief Records a single sample against the supplied probe, registering it if needed. */
+void profiling_record(profiling_probe_t *probe, uint32_t duration);
+
+/** @brief Adds a single sample to the statistics of a probe, without registering it or tracking slow samples. */
+void profiling_probe_add(profiling_probe_t *probe, uint32_t duration);
+
+/** @brief Discards the samples of a single probe. */
+void profiling_probe_clear(profiling_probe_t *probe);
+
+/** @brief Starts timing a section, pass the result to profiling_end(). */
+static inline uint32_t profiling_begin(void) {
+    return profiling_timestamp();
+}
+
+/** @brief Finishes timing a section started with profiling_begin(). */
+static inline void profiling_end(profiling_probe_t *probe, uint32_t start) {
+    profiling_record(probe, profiling_elapsed(start));
+}
+
+#define PROFILE_BLOCK(probe, call)                  \
+    do {                                            \
+        uint32_t profile_start = profiling_begin(); \
+        do {                                        \
+            call;                                   \
+        } while (0);                                \
+        profiling_end(&(probe), profile_start);     \
+    } while (0)
+
+/** @brief Returns the mean sample duration of a probe in microseconds. */
+uint32_t profiling_mean(const profiling_probe_t *probe);
+
+/**
+ * @brief Estimates a percentile of a probe's sample durations from its histogram.
+ *
+ * The result is the upper bound of the histogram bucket holding the requested
+ * percentile, clamped to the observed minimum and maximum, so it is never an
+ * underestimate by more than the bucket resolution.
+ *
+ * @param percentile in the range 0 to 100
+ */
+uint32_t profiling_percentile(const profiling_probe_t *probe, uint8_t percentile);
+
+/** @brief Returns the lower bound, in microseconds, of the supplied histogram bucket. */
+uint32_t profiling_bucket_floor(uint8_t bucket);
+
+/** @brief Dumps the statistics and histogram of a single probe to the console, each line starting with `prefix`. */
+void profiling_probe_print(const char *prefix, const profiling_probe_t *probe);
+
+/**
+ * @brief Serialises the statistics of a single probe into a raw HID packet.
+ *
+ * Request layout, as sent by the host:
+ *     data[0..1]: left untouched
+ *     data[2]:    index of the first histogram bucket to return
+ *
+ * Response layout, all values little-endian:
+ *     data[3]:      number of histogram buckets
+ *     data[4..7]:   sample count
+ *     data[8..11]:  minimum (us)
+ *     data[12..15]: maximum (us)
+ *     data[16..19]: mean (us)
+ *     data[20..23]: 99th percentile estimate (us)
+ *     data[24..]:   uint16_t bucket counts, starting at data[2], as many as fit in `length`
+ *
+ * @return false if `length` is too short to hold the statistics
+ */
+bool profiling_probe_raw_hid_fill(const profiling_probe_t *probe, uint8_t *data, uint8_t length);
+
+#ifdef PROFILING_ENABLE
+/** @brief Returns the first registered probe, follow `next` for the others. */
+profiling_probe_t *profiling_probes(void);
+
+/** @brief Returns the registered probe with the given name, or NULL. */
+profiling_probe_t *profiling_find(const char *name);
+
+/**
+ * @brief Retrieves the slowest samples recorded so far.
+ *
+ * @param index 0 is the slowest sample
+ * @return NULL if fewer than `index + 1` samples were recorded
+ */
+const profiling_sample_t *profiling_slowest(uint8_t index);
+
+/** @brief Discards the samples of all registered probes, the probes stay registered. */
+void profiling_clear(void);
+
+/** @brief Dumps all probes and the slowest samples to the console. */
+void profiling_print(void);
+
+/**
+ * @brief Serialises a registered probe into a raw HID packet.
+ *
+ * Request layout, as sent by the host:
+ *     data[0]: command id, left untouched
+ *     data[1]: index of the probe to dump, in profiling_probes() order
+ *     data[2]: index of the first histogram bucket to return, or 0xFF for the probe name
+ *
+ * The response layout is that of profiling_probe_raw_hid_fill(). When data[2]
+ * is 0xFF, data[3..] instead holds the NUL terminated probe name, truncated
+ * to fit in `length`.
+ *
+ * @return false if the requested probe does not exist
+ */
+bool profiling_raw_hid_fill(uint8_t *data, uint8_t length);
+#endif
@@ -338,119 +338,26 @@ bool process_record_quantum(keyrecord_t *record) {
     }
 #endif
 
-    if (!(
 #if defined(KEY_LOCK_ENABLE)
-            // Must run first to be able to mask key_up events.
-            process_key_lock(&keycode, record) &&
-#endif
-#if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
-            // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
-#endif
-#ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
-#endif
-#if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
-#endif
-#ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
-#endif
-#if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
-#endif
-            process_record_modules(keycode, record) && // modules must run before kb
-            process_record_kb(keycode, record) &&
-#if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
-#endif
-#if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
-#endif
-#if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
-#endif
-#if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
-#endif
-#ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
-#endif
-#if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
-#endif
-#if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
-#endif
-#ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
-#endif
-#if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
-#endif
-#ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
-#endif
-#ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
-#endif
-#ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
-#endif
-#if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
-#endif
-#ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
-#endif
-#ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
-#endif
-#ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
-#endif
-#ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
-#endif
-#ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
-#endif
-#ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
-#endif
-#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
-#endif
-#if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
-#endif
-#ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
-#endif
-#ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
-#endif
-#ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
-#endif
-#ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
-#endif
-#if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
-#endif
-#ifdef LAYER_LOCK_ENABLE
-            process_layer_lock(keycode, record) &&
-#endif
-#ifdef CONNECTION_ENABLE
-            process_connection(keycode, record) &&
-#endif
-#ifndef NO_ACTION_ONESHOT
-            process_oneshot(keycode, record) &&
-#endif
-            process_quantum(keycode, record))) {
+    // Must run first to be able to mask key_up events.
+    if (!process_key_lock(&keycode, record)) {
         return false;
     }
+#endif
+
+    // Each handler only sees the keycodes in its range, see process_record_handlers.inc
+#ifdef PROCESS_RECORD_DISPATCH_ALL
+#    define PROCESS_HANDLER(handler, first, last) \
+        if (!handler(keycode, record)) return false;
+#else
+#    define PROCESS_HANDLER(handler, first, last) \
+        if (keycode >= (first) && keycode <= (last) && !handler(keycode, record)) return false;
+#endif
+#define PROCESS_OBSERVER(handler) \
+    if (!handler(keycode, record)) return false;
+#include "process_record_handlers.inc"
+#undef PROCESS_HANDLER
+#undef PROCESS_OBSERVER
 
     return true;
 }
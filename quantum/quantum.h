@@ -159,6 +159,10 @@ extern layer_state_t layer_state;
 #    include "send_string.h"
 #endif
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string_async.h"
+#endif
+
 #ifdef HAPTIC_ENABLE
 #    include "haptic.h"
 #endif
@@ -249,6 +253,18 @@ extern layer_state_t layer_state;
 #    include "layer_lock.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
+#ifdef PROFILING_ENABLE
+#    include "profiling.h"
+#endif
+
+#ifdef TASK_SCHEDULER_ENABLE
+#    include "task_scheduler.h"
+#endif
+
 #ifdef COMMUNITY_MODULES_ENABLE
 #    include "community_modules.h"
 #endif
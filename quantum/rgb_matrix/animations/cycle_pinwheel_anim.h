@@ -2,13 +2,13 @@
 RGB_MATRIX_EFFECT(CYCLE_PINWHEEL)
 #    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
-static hsv_t CYCLE_PINWHEEL_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t time) {
-    hsv.h = atan2_8(dy, dx) + time;
+static hsv_t CYCLE_PINWHEEL_math(hsv_t hsv, led_polar_t polar, uint8_t time) {
+    hsv.h = polar.angle + time;
     return hsv;
 }
 
 bool CYCLE_PINWHEEL(effect_params_t* params) {
-    return effect_runner_dx_dy(params, &CYCLE_PINWHEEL_math);
+    return effect_runner_polar(params, &CYCLE_PINWHEEL_math);
 }
 
 #    endif // RGB_MATRIX_CUSTOM_EFFECT_IMPLS
@@ -7,17 +7,21 @@ typedef hsv_t (*reactive_splash_f)(hsv_t hsv, int16_t dx, int16_t dy, uint8_t di
 bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
-    uint8_t count = g_last_hit_tracker.count;
+    uint8_t  count = g_last_hit_tracker.count;
+    uint16_t tick[LED_HITS_TO_REMEMBER];
+    for (uint8_t j = start; j < count; j++) {
+        tick[j] = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
+    }
+
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         hsv_t hsv = rgb_matrix_config.hsv;
         hsv.v     = 0;
         for (uint8_t j = start; j < count; j++) {
-            int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
-            int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
-            uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
-            hsv           = effect_func(hsv, dx, dy, dist, tick);
+            int16_t dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+            int16_t dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+            uint8_t dist = rgb_matrix_led_distance(i, g_last_hit_tracker.index[j]);
+            hsv          = effect_func(hsv, dx, dy, dist, tick[j]);
         }
         hsv.v     = scale8(hsv.v, rgb_matrix_config.hsv.v);
         rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
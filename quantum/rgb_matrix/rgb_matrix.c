@@ -28,6 +28,14 @@
 
 #include <lib/lib8tion/lib8tion.h>
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+#    include "timer.h"
+#    include "print.h"
+#    ifdef PROFILING_ENABLE
+#        include "profiling.h"
+#    endif
+#endif
+
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
 #else
@@ -38,6 +46,99 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+static led_polar_t rgb_matrix_compute_led_polar(uint8_t index) {
+    int16_t     dx      = g_led_config.point[index].x - k_rgb_matrix_center.x;
+    int16_t     dy      = g_led_config.point[index].y - k_rgb_matrix_center.y;
+    int16_t     dual_dx = (k_rgb_matrix_center.x / 2) - abs8(dx);
+    led_polar_t polar   = {
+        .angle     = atan2_8(dy, dx),
+        .dist      = sqrt16(dx * dx + dy * dy),
+        .dual_dist = sqrt16(dual_dx * dual_dx + dy * dy),
+    };
+    return polar;
+}
+
+#ifdef RGB_MATRIX_LED_POLAR_TABLE
+// Generated alongside g_led_config from the info.json layout; NULL when g_led_config is hand written.
+// The pointer is not const, as GCC folds a const weak NULL into the check below even when it is overridden.
+__attribute__((weak)) const led_polar_t *g_led_polar = NULL;
+
+// g_led_polar once it has been checked against g_led_config and k_rgb_matrix_center
+static const led_polar_t *led_polar = NULL;
+
+static void rgb_matrix_init_led_polar(void) {
+    led_polar = NULL;
+    if (g_led_polar == NULL) {
+        return;
+    }
+
+    // A keymap level RGB_MATRIX_CENTER or a g_led_config replaced in code would make the table stale
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        led_polar_t expected = rgb_matrix_compute_led_polar(i);
+        if (memcmp_P(&expected, &g_led_polar[i], sizeof(expected)) != 0) {
+            dprintf("rgb_matrix: g_led_polar does not match g_led_config at LED %u, computing per frame\n", i);
+            return;
+        }
+    }
+    led_polar = g_led_polar;
+}
+#endif
+
+led_polar_t rgb_matrix_led_polar(uint8_t index) {
+#ifdef RGB_MATRIX_LED_POLAR_TABLE
+    if (led_polar != NULL) {
+        led_polar_t polar;
+        memcpy_P(&polar, &led_polar[index], sizeof(polar));
+        return polar;
+    }
+#endif
+    return rgb_matrix_compute_led_polar(index);
+}
+
+static uint8_t rgb_matrix_compute_led_distance(uint8_t a, uint8_t b) {
+    int16_t dx = g_led_config.point[a].x - g_led_config.point[b].x;
+    int16_t dy = g_led_config.point[a].y - g_led_config.point[b].y;
+    return sqrt16(dx * dx + dy * dy);
+}
+
+#ifdef RGB_MATRIX_LED_DISTANCE_TABLE
+// Generated alongside g_led_config: the distance between every pair of LEDs, ordered by the higher index then the lower.
+// Not a const pointer, for the same reason as g_led_polar.
+__attribute__((weak)) const uint8_t *g_led_distance = NULL;
+
+// g_led_distance once it has been checked against g_led_config
+static const uint8_t *led_distance = NULL;
+
+static void rgb_matrix_init_led_distance(void) {
+    led_distance = NULL;
+    if (g_led_distance == NULL) {
+        return;
+    }
+
+    const uint8_t *distance = g_led_distance;
+    for (uint8_t hi = 1; hi < RGB_MATRIX_LED_COUNT; hi++) {
+        for (uint8_t lo = 0; lo < hi; lo++, distance++) {
+            if (pgm_read_byte(distance) != rgb_matrix_compute_led_distance(hi, lo)) {
+                dprintf("rgb_matrix: g_led_distance does not match g_led_config at LEDs %u and %u, computing per frame\n", lo, hi);
+                return;
+            }
+        }
+    }
+    led_distance = g_led_distance;
+}
+#endif
+
+uint8_t rgb_matrix_led_distance(uint8_t a, uint8_t b) {
+#ifdef RGB_MATRIX_LED_DISTANCE_TABLE
+    if (led_distance != NULL && a != b) {
+        uint8_t hi = a > b ? a : b;
+        uint8_t lo = a > b ? b : a;
+        return pgm_read_byte(&led_distance[(uint16_t)hi * (hi - 1) / 2 + lo]);
+    }
+#endif
+    return rgb_matrix_compute_led_distance(a, b);
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -85,6 +186,37 @@ static uint32_t rgb_timer_buffer;
 static last_hit_t last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+// adaptive slicing: each slice is sized from the measured per LED cost of the effect to fit the budget
+static uint8_t            rgb_render_slice[RGB_MATRIX_LED_COUNT + 1]; // first LED of each slice of the frame, then its end
+static uint16_t           rgb_render_cost[RGB_MATRIX_EFFECT_MAX];     // per LED in 1/256us, 0 until measured
+static rgb_render_stats_t rgb_render_stats;
+#    ifdef PROFILING_ENABLE
+static profiling_probe_t rgb_render_probe = PROFILING_PROBE("rgb render");
+#    endif
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
+#ifdef RGB_MATRIX_FRAME_SKIP
+// frame skipping: every color written while drawing a frame is folded into a hash,
+// so a frame identical to the last one can go unflushed, or for static effects unrendered
+typedef enum { RGB_FRAME_IDLE, RGB_FRAME_EFFECT, RGB_FRAME_INDICATORS, RGB_FRAME_PROBE, RGB_FRAME_FLUSH } rgb_frame_stage_t;
+
+static struct {
+    rgb_frame_stage_t stage;
+    bool              in_sync; // the LEDs show the last frame, with nothing written since
+    uint32_t          hash;
+    uint32_t          indicator_hash;
+    uint32_t          last_hash;
+    uint32_t          last_indicator_hash;
+    uint8_t           last_iter;
+    rgb_config_t      last_config;
+} rgb_frame;
+
+#    define RGB_FRAME_STAGE(s) rgb_frame.stage = (s)
+#else
+#    define RGB_FRAME_STAGE(s)
+#endif // RGB_MATRIX_FRAME_SKIP
+
 // split rgb matrix
 #if defined(RGB_MATRIX_SPLIT)
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
@@ -158,7 +290,43 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
     return index;
 }
 
+#ifdef RGB_MATRIX_FRAME_SKIP
+static uint32_t rgb_frame_mix(uint8_t index, uint8_t red, uint8_t green, uint8_t blue) {
+    // Offsetting the index leaves LED 254 set to black as the only write with a zero mix, rather than LED 0, which the
+    // sum would not see
+    uint32_t x = ((uint32_t)(index ^ 0xFE) << 24) | ((uint32_t)red << 16) | ((uint32_t)green << 8) | blue;
+    // Bijective, so changing any single write always changes the sum
+    x ^= x >> 16;
+    x *= 0x45D9F3B;
+    x ^= x >> 16;
+    return x;
+}
+
+// Returns false if the color should not reach the driver
+static bool rgb_frame_record(uint8_t index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (rgb_frame.stage == RGB_FRAME_IDLE) {
+        // Written from outside a frame, e.g. a keymap; the next frame must be flushed
+        rgb_frame.in_sync = false;
+        return true;
+    }
+
+    // Summed rather than chained, as indicator slices may be drawn in a different order
+    uint32_t mix = rgb_frame_mix(index, red, green, blue);
+    if (rgb_frame.stage != RGB_FRAME_EFFECT) {
+        rgb_frame.indicator_hash += mix;
+    }
+    if (rgb_frame.stage == RGB_FRAME_PROBE) {
+        return false;
+    }
+    rgb_frame.hash += mix;
+    return true;
+}
+#endif // RGB_MATRIX_FRAME_SKIP
+
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_FRAME_SKIP
+    if (!rgb_frame_record(index, red, green, blue)) return;
+#endif
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
 }
 
@@ -167,6 +335,9 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
+#    ifdef RGB_MATRIX_FRAME_SKIP
+    if (!rgb_frame_record(NO_LED, red, green, blue)) return;
+#    endif
     rgb_matrix_driver.set_color_all(red, green, blue);
 #endif
 }
@@ -279,7 +450,59 @@ static void rgb_task_sync(void) {
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
 }
 
-static void rgb_task_start(void) {
+#ifdef RGB_MATRIX_FRAME_SKIP
+// Effects whose output depends on nothing but rgb_matrix_config and g_led_config,
+// a keymap may override this to add its own
+__attribute__((weak)) bool rgb_matrix_effect_is_static(uint8_t mode) {
+    switch (mode) {
+        case RGB_MATRIX_SOLID_COLOR:
+#    ifdef ENABLE_RGB_MATRIX_GRADIENT_UP_DOWN
+        case RGB_MATRIX_GRADIENT_UP_DOWN:
+#    endif
+#    ifdef ENABLE_RGB_MATRIX_GRADIENT_LEFT_RIGHT
+        case RGB_MATRIX_GRADIENT_LEFT_RIGHT:
+#    endif
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool rgb_frame_is_unchanged(uint8_t effect) {
+    if (!rgb_frame.in_sync || !rgb_matrix_effect_is_static(effect) || effect != rgb_last_effect || rgb_matrix_config.enable != rgb_last_enable || rgb_matrix_config.raw != rgb_frame.last_config.raw) {
+        return false;
+    }
+
+    // The effect would draw the same colors again, but the indicators may not:
+    // draw them into the hash only, slice by slice as the last frame did
+    effect_params_t params = rgb_effect_params;
+
+    rgb_frame.indicator_hash = 0;
+    RGB_FRAME_STAGE(RGB_FRAME_PROBE);
+    rgb_matrix_indicators();
+    for (params.iter = 1; params.iter <= rgb_frame.last_iter; params.iter++) {
+        rgb_matrix_indicators_advanced(&params);
+    }
+    RGB_FRAME_STAGE(RGB_FRAME_IDLE);
+
+    return rgb_frame.indicator_hash == rgb_frame.last_indicator_hash;
+}
+
+// Returns true if the frame just drawn matches the one the LEDs already show
+static bool rgb_frame_end(void) {
+    bool unchanged = rgb_frame.stage == RGB_FRAME_FLUSH && rgb_frame.in_sync && rgb_frame.hash == rgb_frame.last_hash;
+
+    // A flush from outside rgb_matrix_task(), e.g. on suspend, leaves the LEDs in a state no hash describes
+    rgb_frame.in_sync             = rgb_frame.stage == RGB_FRAME_FLUSH;
+    rgb_frame.last_hash           = rgb_frame.hash;
+    rgb_frame.last_indicator_hash = rgb_frame.indicator_hash;
+    rgb_frame.last_iter           = rgb_effect_params.iter;
+    rgb_frame.last_config         = rgb_matrix_config;
+    return unchanged;
+}
+#endif // RGB_MATRIX_FRAME_SKIP
+
+static void rgb_task_start(uint8_t effect) {
     // reset iter
     rgb_effect_params.iter = 0;
 
@@ -289,10 +512,107 @@ static void rgb_task_start(void) {
     g_last_hit_tracker = last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_FRAME_SKIP
+    if (rgb_frame_is_unchanged(effect)) {
+        rgb_task_state = SYNCING;
+        return;
+    }
+    rgb_frame.hash           = 0;
+    rgb_frame.indicator_hash = 0;
+#endif // RGB_MATRIX_FRAME_SKIP
+
     // next task
     rgb_task_state = RENDERING;
 }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+static uint8_t rgb_render_slice_length(uint8_t effect) {
+    uint16_t cost = effect < RGB_MATRIX_EFFECT_MAX ? rgb_render_cost[effect] : 0;
+    if (cost == 0) {
+#    if RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+        return RGB_MATRIX_LED_PROCESS_LIMIT;
+#    else
+        return RGB_MATRIX_LED_COUNT;
+#    endif
+    }
+
+    uint32_t length = (uint32_t)RGB_MATRIX_RENDER_BUDGET_US * 256 / cost;
+    if (length < 1) return 1;
+    if (length > RGB_MATRIX_LED_COUNT) return RGB_MATRIX_LED_COUNT;
+    return length;
+}
+
+static void rgb_render_plan_slice(uint8_t effect, uint8_t iter) {
+#    if defined(RGB_MATRIX_SPLIT)
+    uint8_t first = is_keyboard_left() ? 0 : k_rgb_matrix_split[0];
+    uint8_t end   = is_keyboard_left() ? k_rgb_matrix_split[0] : RGB_MATRIX_LED_COUNT;
+#    else
+    uint8_t first = 0;
+    uint8_t end   = RGB_MATRIX_LED_COUNT;
+#    endif
+    if (iter == 0) {
+        rgb_render_slice[0] = first;
+    } else if (iter >= RGB_MATRIX_LED_COUNT) {
+        // Only the suspend path renders past the end of a frame, with an effect which ignores the limits
+        return;
+    }
+
+    uint8_t start  = rgb_render_slice[iter];
+    uint8_t length = rgb_render_slice_length(effect);
+
+    rgb_render_slice[iter + 1] = end - start > length ? start + length : end;
+}
+
+static void rgb_render_measure(uint8_t effect, uint32_t start) {
+    // iter has already moved past the slice just drawn, unless no slice was (the factory test pattern)
+    if (rgb_effect_params.iter == 0 || effect >= RGB_MATRIX_EFFECT_MAX) {
+        return;
+    }
+
+    uint32_t elapsed = timer_stamp_elapsed_us(start);
+    uint8_t  leds    = rgb_render_slice[rgb_effect_params.iter] - rgb_render_slice[rgb_effect_params.iter - 1];
+
+#    ifdef PROFILING_ENABLE
+    profiling_record(&rgb_render_probe, elapsed);
+#    endif
+    rgb_render_stats.slices++;
+    if (elapsed > RGB_MATRIX_RENDER_BUDGET_US) {
+        rgb_render_stats.over_budget++;
+    }
+    if (rgb_task_state != RENDERING) {
+        rgb_render_stats.frames++;
+    }
+    if (leds == 0) {
+        return;
+    }
+
+    uint32_t sample = elapsed * 256 / leds;
+    if (sample == 0) sample = 1;
+    if (sample > UINT16_MAX) sample = UINT16_MAX;
+
+    // Smoothed, so a single slice stretched by an interrupt barely shrinks the next ones
+    int32_t cost            = rgb_render_cost[effect];
+    rgb_render_cost[effect] = cost == 0 ? sample : cost + ((int32_t)sample - cost) / 4;
+}
+
+const rgb_render_stats_t *rgb_matrix_get_render_stats(void) {
+    return &rgb_render_stats;
+}
+
+void rgb_matrix_print_render_stats(void) {
+    uprintf("rgb render: budget=%uus frames=%lu slices=%lu over budget=%lu\n", RGB_MATRIX_RENDER_BUDGET_US, (unsigned long)rgb_render_stats.frames, (unsigned long)rgb_render_stats.slices, (unsigned long)rgb_render_stats.over_budget);
+    for (uint8_t mode = 0; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        uint16_t cost = rgb_render_cost[mode];
+        if (cost == 0) continue;
+#    ifdef RGB_MATRIX_MODE_NAME_ENABLE
+        uprintf("  mode %u %s: %u.%02uus/LED, %u LEDs/slice\n", mode, rgb_matrix_get_mode_name(mode), cost >> 8, (cost & 0xFF) * 100 / 256, rgb_render_slice_length(mode));
+#    else
+        uprintf("  mode %u: %u.%02uus/LED, %u LEDs/slice\n", mode, cost >> 8, (cost & 0xFF) * 100 / 256, rgb_render_slice_length(mode));
+#    endif
+    }
+}
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 static void rgb_task_render(uint8_t effect) {
     bool rendering         = false;
     rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
@@ -301,6 +621,10 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_plan_slice(effect, rgb_effect_params.iter);
+#endif
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -367,8 +691,11 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
-    // update pwm buffers
-    rgb_matrix_update_pwm_buffers();
+    // update pwm buffers, unless nothing changed since the last frame
+#ifdef RGB_MATRIX_FRAME_SKIP
+    if (!rgb_frame_end())
+#endif
+        rgb_matrix_update_pwm_buffers();
 
     // next task
     rgb_task_state = SYNCING;
@@ -389,19 +716,31 @@ void rgb_matrix_task(void) {
 
     switch (rgb_task_state) {
         case STARTING:
-            rgb_task_start();
+            rgb_task_start(effect);
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+            uint32_t render_start = timer_read_stamp();
+#endif
+            RGB_FRAME_STAGE(RGB_FRAME_EFFECT);
             rgb_task_render(effect);
             if (effect) {
+                RGB_FRAME_STAGE(RGB_FRAME_INDICATORS);
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
                     rgb_matrix_indicators();
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
             }
+            RGB_FRAME_STAGE(RGB_FRAME_IDLE);
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+            rgb_render_measure(effect, render_start);
+#endif
             break;
+        }
         case FLUSHING:
+            RGB_FRAME_STAGE(RGB_FRAME_FLUSH);
             rgb_task_flush(effect);
+            RGB_FRAME_STAGE(RGB_FRAME_IDLE);
             break;
         case SYNCING:
             rgb_task_sync();
@@ -428,7 +767,11 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#if defined(RGB_MATRIX_RENDER_BUDGET_US)
+    // planned by rgb_render_plan_slice() within this half
+    limits.led_min_index = rgb_render_slice[iter];
+    limits.led_max_index = rgb_render_slice[iter + 1];
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
 #    if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
@@ -479,6 +822,12 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
+#ifdef RGB_MATRIX_LED_POLAR_TABLE
+    rgb_matrix_init_led_polar();
+#endif
+#ifdef RGB_MATRIX_LED_DISTANCE_TABLE
+    rgb_matrix_init_led_distance();
+#endif
 
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
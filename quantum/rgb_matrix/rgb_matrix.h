@@ -153,6 +153,11 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
 
 int rgb_matrix_led_index(int index);
 
+// Position of an LED relative to k_rgb_matrix_center, from the table generated from info.json when available
+led_polar_t rgb_matrix_led_polar(uint8_t index);
+// Distance between two LEDs, from the table generated from info.json when available
+uint8_t rgb_matrix_led_distance(uint8_t a, uint8_t b);
+
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
@@ -170,6 +175,11 @@ void rgb_matrix_indicators_advanced(effect_params_t *params);
 bool rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
+#ifdef RGB_MATRIX_FRAME_SKIP
+// Whether an effect draws the same frame for as long as rgb_matrix_config is unchanged
+bool rgb_matrix_effect_is_static(uint8_t mode);
+#endif
+
 void rgb_matrix_init(void);
 
 void rgb_matrix_reload_from_eeprom(void);
@@ -224,6 +234,17 @@ void        rgb_matrix_update_pwm_buffers(void);
 const char *rgb_matrix_get_mode_name(uint8_t mode);
 #endif // RGB_MATRIX_MODE_NAME_ENABLE
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+typedef struct {
+    uint32_t frames;
+    uint32_t slices;
+    uint32_t over_budget; // slices which took longer than RGB_MATRIX_RENDER_BUDGET_US
+} rgb_render_stats_t;
+
+const rgb_render_stats_t *rgb_matrix_get_render_stats(void);
+void                      rgb_matrix_print_render_stats(void);
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_force_flush_rgb_matrix
 #    define rgblight_reload_from_eeprom rgb_matrix_reload_from_eeprom
@@ -284,6 +305,12 @@ extern rgb_config_t rgb_matrix_config;
 
 extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
+#ifdef RGB_MATRIX_LED_POLAR_TABLE
+extern const led_polar_t *g_led_polar;
+#endif
+#ifdef RGB_MATRIX_LED_DISTANCE_TABLE
+extern const uint8_t *g_led_distance;
+#endif
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
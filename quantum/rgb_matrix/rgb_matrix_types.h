@@ -27,6 +27,11 @@
 #    define RGB_MATRIX_KEYREACTIVE_ENABLED
 #endif
 
+// Positions relative to the center are looked up from a generated table by the effects that need them
+#if (defined(ENABLE_RGB_MATRIX_BAND_PINWHEEL_SAT) || defined(ENABLE_RGB_MATRIX_BAND_PINWHEEL_VAL) || defined(ENABLE_RGB_MATRIX_BAND_SPIRAL_SAT) || defined(ENABLE_RGB_MATRIX_BAND_SPIRAL_VAL) || defined(ENABLE_RGB_MATRIX_CYCLE_OUT_IN) || defined(ENABLE_RGB_MATRIX_CYCLE_OUT_IN_DUAL) || defined(ENABLE_RGB_MATRIX_CYCLE_PINWHEEL) || defined(ENABLE_RGB_MATRIX_CYCLE_SPIRAL)) && !defined(RGB_MATRIX_NO_LED_POLAR_TABLE)
+#    define RGB_MATRIX_LED_POLAR_TABLE
+#endif
+
 // Last led hit
 #ifndef LED_HITS_TO_REMEMBER
 #    define LED_HITS_TO_REMEMBER 8
@@ -57,6 +62,13 @@ typedef struct PACKED {
     uint8_t y;
 } led_point_t;
 
+/* LED position relative to the matrix center, see rgb_matrix_led_polar() */
+typedef struct PACKED {
+    uint8_t angle;     // atan2_8(dy, dx)
+    uint8_t dist;      // sqrt16(dx * dx + dy * dy)
+    uint8_t dual_dist; // distance to the nearer of the two points at (center.x / 2, 0) either side of the center
+} led_polar_t;
+
 #define HAS_FLAGS(bits, flags) ((bits & flags) == flags)
 #define HAS_ANY_FLAGS(bits, flags) ((bits & flags) != 0x00)
 
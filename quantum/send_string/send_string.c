@@ -24,6 +24,13 @@
 #include "action.h"
 #include "wait.h"
 
+#ifdef SEND_STRING_BULK_TYPING
+#    include "action_util.h"
+#    include "host.h"
+#    include "keycode_config.h"
+#    include "util.h"
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -146,6 +153,106 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+#ifdef SEND_STRING_BULK_TYPING
+/* Keys waiting to be pressed together, in ascending usage order, and the
+ * modifiers currently held for them.
+ */
+static uint8_t bulk_keys[SEND_STRING_BULK_SIZE];
+static uint8_t bulk_count = 0;
+static uint8_t bulk_mods  = 0;
+
+/** \brief The number of keys which can be pressed in a single report. */
+static uint8_t bulk_limit(void) {
+#    ifdef NKRO_ENABLE
+    if (host_can_send_nkro() && keymap_config.nkro) {
+        return SEND_STRING_BULK_SIZE;
+    }
+#    endif
+    // Leave the slots of keys which are already held alone
+    uint8_t held = has_anykey();
+    uint8_t free = held < KEYBOARD_REPORT_KEYS ? KEYBOARD_REPORT_KEYS - held : 1;
+    return MIN(free, SEND_STRING_BULK_SIZE);
+}
+
+/** \brief Presses all pending keys in one report and releases them in the next. */
+static void bulk_send_keys(void) {
+    if (!bulk_count) {
+        return;
+    }
+    for (uint8_t i = 0; i < bulk_count; i++) {
+        add_key(bulk_keys[i]);
+    }
+    send_keyboard_report();
+    for (uint8_t i = 0; i < bulk_count; i++) {
+        del_key(bulk_keys[i]);
+    }
+    send_keyboard_report();
+    bulk_count = 0;
+}
+
+static void bulk_set_mods(uint8_t mods) {
+    // Same order as send_char_with_delay(), shift wraps altgr
+    if ((bulk_mods & ~mods) & MOD_BIT(KC_RIGHT_ALT)) {
+        unregister_code(KC_RIGHT_ALT);
+    }
+    if ((bulk_mods & ~mods) & MOD_BIT(KC_LEFT_SHIFT)) {
+        unregister_code(KC_LEFT_SHIFT);
+    }
+    if ((mods & ~bulk_mods) & MOD_BIT(KC_LEFT_SHIFT)) {
+        register_code(KC_LEFT_SHIFT);
+    }
+    if ((mods & ~bulk_mods) & MOD_BIT(KC_RIGHT_ALT)) {
+        register_code(KC_RIGHT_ALT);
+    }
+    bulk_mods = mods;
+}
+
+static void bulk_add(uint8_t keycode, uint8_t mods) {
+    // Hosts handle the keys of a report in usage order, so a key can only
+    // join the pending ones if it comes after them.
+    if (bulk_count && (mods != bulk_mods || keycode <= bulk_keys[bulk_count - 1] || bulk_count >= bulk_limit())) {
+        bulk_send_keys();
+    }
+    if (mods != bulk_mods) {
+        bulk_set_mods(mods);
+    }
+    bulk_keys[bulk_count++] = keycode;
+}
+
+void send_string_bulk_tap_code(uint8_t keycode) {
+    bulk_add(keycode, 0);
+}
+
+void send_string_bulk_char(char ascii_code) {
+    uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_dead = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+    bool    is_bell = false;
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    is_bell = ascii_code == '\a';
+#    endif
+
+    if (keycode == KC_NO || is_dead || is_bell) {
+        send_string_bulk_flush();
+        send_char_with_delay(ascii_code, 0);
+        return;
+    }
+
+    uint8_t mods = 0;
+    if (PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code)) {
+        mods |= MOD_BIT(KC_LEFT_SHIFT);
+    }
+    if (PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code)) {
+        mods |= MOD_BIT(KC_RIGHT_ALT);
+    }
+    bulk_add(keycode, mods);
+}
+
+void send_string_bulk_flush(void) {
+    bulk_send_keys();
+    bulk_set_mods(0);
+}
+#endif
+
 void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
@@ -153,6 +260,15 @@ void send_string(const char *string) {
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
     while (1) {
         char ascii_code = getter(arg);
+#ifdef SEND_STRING_BULK_TYPING
+        if (interval == 0) {
+            if (ascii_code && ascii_code != SS_QMK_PREFIX) {
+                send_string_bulk_char(ascii_code);
+                continue;
+            }
+            send_string_bulk_flush();
+        }
+#endif
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
             ascii_code = getter(arg);
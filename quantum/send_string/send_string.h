@@ -82,6 +82,40 @@ void send_char(char ascii_code);
  */
 void send_char_with_delay(char ascii_code, uint8_t interval);
 
+#if defined(SEND_STRING_BULK_TYPING) || defined(__DOXYGEN__)
+/**
+ * \brief The maximum number of keys pressed together by the bulk typing mode.
+ *
+ * Without NKRO the limit is the number of free slots in the 6KRO report.
+ */
+#    ifndef SEND_STRING_BULK_SIZE
+#        define SEND_STRING_BULK_SIZE 8
+#    endif
+
+/**
+ * \brief Queue an ASCII character to be typed out in bulk.
+ *
+ * Consecutive characters with ascending keycodes and the same modifiers are
+ * pressed in a single report, and released in the next. Call
+ * send_string_bulk_flush() to type out whatever is still pending.
+ *
+ * \param ascii_code The character to type.
+ */
+void send_string_bulk_char(char ascii_code);
+
+/**
+ * \brief Queue a basic keycode to be tapped in bulk, without any modifiers.
+ *
+ * \param keycode The keycode to tap.
+ */
+void send_string_bulk_tap_code(uint8_t keycode);
+
+/**
+ * \brief Type out any pending bulk keys, and release the modifiers held for them.
+ */
+void send_string_bulk_flush(void);
+#endif
+
 /**
  * \brief Type out an eight digit (unsigned 32-bit) hexadecimal value.
  *
@@ -0,0 +1,369 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "send_string_async.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include "send_string.h"
+#include "action.h"
+#include "action_util.h"
+#include "keycode.h"
+#include "timer.h"
+
+/* Queued strings are stored back to back as
+ *
+ *     [interval] [string bytes...] [0]
+ *
+ * and consumed one report at a time. Every step of the engine changes the
+ * report at most once, then waits for the string's interval before the next.
+ */
+
+/**
+ * \brief Maximum number of characters pressed together in a single report, see SEND_STRING_ASYNC_MAX_THROUGHPUT.
+ */
+#ifndef SEND_STRING_ASYNC_PACK_SIZE
+#    define SEND_STRING_ASYNC_PACK_SIZE 4
+#endif
+
+#if SEND_STRING_ASYNC_BUFFER_SIZE > 0xFFFF
+#    error "SEND_STRING_ASYNC_BUFFER_SIZE must fit in 16 bits"
+#endif
+
+// Note: we bit-pack in "reverse" order to optimize loading
+#define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
+
+typedef enum {
+    STEP_IDLE,     // nothing left to do
+    STEP_CONTINUE, // consumed input without changing the report
+    STEP_REPORT,   // changed the report, wait for the interval
+    STEP_WAIT,     // waiting for an explicit delay
+} step_result_t;
+
+static uint8_t  buffer[SEND_STRING_ASYNC_BUFFER_SIZE];
+static uint16_t head = 0;
+static uint16_t used = 0;
+
+static bool     in_string = false;
+static uint8_t  interval  = 0;
+static bool     waiting   = false;
+static uint32_t wake_time = 0;
+
+/* Keys held by the engine */
+static uint8_t held_mods = 0;
+static uint8_t pressed[SEND_STRING_ASYNC_PACK_SIZE];
+static uint8_t pressed_count = 0;
+static uint8_t tapped_code   = KC_NO;
+static bool    dead_pending  = false;
+
+static uint8_t peek(uint16_t offset) {
+    return buffer[(head + offset) % SEND_STRING_ASYNC_BUFFER_SIZE];
+}
+
+static uint8_t pop(void) {
+    uint8_t value = buffer[head];
+    head          = (head + 1) % SEND_STRING_ASYNC_BUFFER_SIZE;
+    --used;
+    return value;
+}
+
+static void push(uint8_t value) {
+    buffer[(head + used) % SEND_STRING_ASYNC_BUFFER_SIZE] = value;
+    ++used;
+}
+
+uint16_t send_string_async_free(void) {
+    return SEND_STRING_ASYNC_BUFFER_SIZE - used;
+}
+
+static bool enqueue(const char *string, uint8_t delay, uint8_t (*getter)(const char *)) {
+    uint16_t length = 0;
+    while (getter(string + length)) {
+        if (++length > SEND_STRING_ASYNC_BUFFER_SIZE) {
+            return false;
+        }
+    }
+    if ((uint32_t)length + 2 > send_string_async_free()) {
+        return false;
+    }
+
+    push(delay);
+    for (uint16_t i = 0; i < length; i++) {
+        push(getter(string + i));
+    }
+    push(0);
+    return true;
+}
+
+static uint8_t get_ram(const char *p) {
+    return *p;
+}
+
+bool send_string_async_with_delay(const char *string, uint8_t interval) {
+    return enqueue(string, interval, get_ram);
+}
+
+bool send_string_async(const char *string) {
+    return send_string_async_with_delay(string, TAP_CODE_DELAY);
+}
+
+#if defined(__AVR__)
+static uint8_t get_progmem(const char *p) {
+    return pgm_read_byte(p);
+}
+
+bool send_string_async_with_delay_P(const char *string, uint8_t interval) {
+    return enqueue(string, interval, get_progmem);
+}
+#endif
+
+static bool engine_holds_keys(void) {
+    return held_mods || pressed_count || tapped_code != KC_NO || dead_pending;
+}
+
+bool send_string_async_busy(void) {
+    return used || in_string || waiting || engine_holds_keys();
+}
+
+bool send_string_async_next_deadline(uint32_t *deadline) {
+    if (waiting) {
+        *deadline = wake_time;
+        return true;
+    }
+    if (send_string_async_busy()) {
+        *deadline = timer_read32();
+        return true;
+    }
+    return false;
+}
+
+/** \brief The modifiers needed to type a character. */
+static uint8_t char_mods(uint8_t ascii_code) {
+    uint8_t mods = 0;
+    if (PGM_LOADBIT(ascii_to_shift_lut, ascii_code)) {
+        mods |= MOD_BIT(KC_LEFT_SHIFT);
+    }
+    if (PGM_LOADBIT(ascii_to_altgr_lut, ascii_code)) {
+        mods |= MOD_BIT(KC_RIGHT_ALT);
+    }
+    return mods;
+}
+
+static uint8_t char_keycode(uint8_t ascii_code) {
+    return ascii_code < 128 ? pgm_read_byte(&ascii_to_keycode_lut[ascii_code]) : KC_NO;
+}
+
+#ifdef SEND_STRING_ASYNC_MAX_THROUGHPUT
+/** \brief Whether a queued byte is a plain character which can share a report with the previous one. */
+static bool can_pack(uint8_t ascii_code, uint8_t mods, uint8_t previous_keycode) {
+    if (ascii_code == 0 || ascii_code == SS_QMK_PREFIX || ascii_code >= 128) {
+        return false;
+    }
+    if (char_mods(ascii_code) != mods || PGM_LOADBIT(ascii_to_dead_lut, ascii_code)) {
+        return false;
+    }
+    // Hosts process the keys of a report in usage order, so only ascending
+    // keycodes are typed in the order they were queued.
+    return char_keycode(ascii_code) > previous_keycode;
+}
+#endif
+
+/** \brief Moves the engine's modifiers one step closer to `mods`, returns false if they already match. */
+static bool step_mods(uint8_t mods) {
+    // Same order as send_char(), shift wraps altgr
+    if ((held_mods & ~mods) & MOD_BIT(KC_RIGHT_ALT)) {
+        unregister_code(KC_RIGHT_ALT);
+        held_mods &= ~MOD_BIT(KC_RIGHT_ALT);
+    } else if ((held_mods & ~mods) & MOD_BIT(KC_LEFT_SHIFT)) {
+        unregister_code(KC_LEFT_SHIFT);
+        held_mods &= ~MOD_BIT(KC_LEFT_SHIFT);
+    } else if ((mods & ~held_mods) & MOD_BIT(KC_LEFT_SHIFT)) {
+        register_code(KC_LEFT_SHIFT);
+        held_mods |= MOD_BIT(KC_LEFT_SHIFT);
+    } else if ((mods & ~held_mods) & MOD_BIT(KC_RIGHT_ALT)) {
+        register_code(KC_RIGHT_ALT);
+        held_mods |= MOD_BIT(KC_RIGHT_ALT);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static step_result_t step_command(void) {
+    // Truncated commands are dropped, without consuming the string terminator
+    uint8_t command = peek(1);
+    if (command == 0 || (command != SS_DELAY_CODE && peek(2) == 0)) {
+        pop();
+        if (command) {
+            pop();
+        }
+        return STEP_CONTINUE;
+    }
+    pop(); // SS_QMK_PREFIX
+    pop();
+
+    switch (command) {
+        case SS_TAP_CODE:
+            tapped_code = pop();
+            register_code(tapped_code);
+            if (tapped_code == KC_CAPS_LOCK && TAP_HOLD_CAPS_DELAY > interval) {
+                // Same hold time as tap_code()
+                waiting   = true;
+                wake_time = timer_read32() + TAP_HOLD_CAPS_DELAY;
+                return STEP_WAIT;
+            }
+            return STEP_REPORT;
+        case SS_DOWN_CODE:
+            register_code(pop());
+            return STEP_REPORT;
+        case SS_UP_CODE:
+            unregister_code(pop());
+            return STEP_REPORT;
+        case SS_DELAY_CODE: {
+            uint32_t ms = 0;
+            while (isdigit(peek(0))) {
+                ms = ms * 10 + (pop() - '0');
+            }
+            // Drop the delimiter, the string terminator is handled by the caller
+            if (peek(0)) {
+                pop();
+            }
+            waiting   = true;
+            wake_time = timer_read32() + ms + interval;
+            return STEP_WAIT;
+        }
+        default:
+            return STEP_CONTINUE;
+    }
+}
+
+static step_result_t step_char(void) {
+    uint8_t ascii_code = peek(0);
+    uint8_t keycode    = char_keycode(ascii_code);
+    if (keycode == KC_NO) {
+        pop();
+        return STEP_CONTINUE;
+    }
+
+    if (step_mods(char_mods(ascii_code))) {
+        return STEP_REPORT;
+    }
+
+    pop();
+    pressed[pressed_count++] = keycode;
+    dead_pending             = PGM_LOADBIT(ascii_to_dead_lut, ascii_code);
+    add_key(keycode);
+
+#ifdef SEND_STRING_ASYNC_MAX_THROUGHPUT
+    if (interval == 0 && !dead_pending) {
+        while (pressed_count < SEND_STRING_ASYNC_PACK_SIZE && used && can_pack(peek(0), held_mods, pressed[pressed_count - 1])) {
+            keycode                  = char_keycode(pop());
+            pressed[pressed_count++] = keycode;
+            add_key(keycode);
+        }
+    }
+#endif
+
+    send_keyboard_report();
+    return STEP_REPORT;
+}
+
+static step_result_t step(void) {
+    // Finish whatever the previous step started
+    if (pressed_count) {
+        for (uint8_t i = 0; i < pressed_count; i++) {
+            del_key(pressed[i]);
+        }
+        pressed_count = 0;
+        send_keyboard_report();
+        return STEP_REPORT;
+    }
+    if (tapped_code != KC_NO) {
+        unregister_code(tapped_code);
+        tapped_code = KC_NO;
+        return STEP_REPORT;
+    }
+    if (dead_pending) {
+        dead_pending = false;
+        tapped_code  = KC_SPACE;
+        register_code(KC_SPACE);
+        return STEP_REPORT;
+    }
+
+    if (!in_string) {
+        if (!used) {
+            return step_mods(0) ? STEP_REPORT : STEP_IDLE;
+        }
+        interval  = pop();
+        in_string = true;
+    }
+
+    uint8_t next = peek(0);
+    if (next == 0) {
+        // Release the modifiers before moving on, as send_string() would have
+        if (step_mods(0)) {
+            return STEP_REPORT;
+        }
+        pop();
+        in_string = false;
+        return STEP_CONTINUE;
+    }
+    if (next == SS_QMK_PREFIX) {
+        if (step_mods(0)) {
+            return STEP_REPORT;
+        }
+        return step_command();
+    }
+    return step_char();
+}
+
+void send_string_async_task(void) {
+    if (waiting) {
+        if (!timer_expired32(timer_read32(), wake_time)) {
+            return;
+        }
+        waiting = false;
+    }
+
+    step_result_t result;
+    do {
+        result = step();
+    } while (result == STEP_CONTINUE);
+
+    if (result == STEP_REPORT) {
+        uint8_t delay = interval;
+#ifdef SEND_STRING_ASYNC_MAX_THROUGHPUT
+        // One report per USB frame
+        if (delay == 0) {
+            delay = 1;
+        }
+#endif
+        if (delay) {
+            waiting   = true;
+            wake_time = timer_read32() + delay;
+        }
+    }
+}
+
+void send_string_async_cancel(void) {
+    for (uint8_t i = 0; i < pressed_count; i++) {
+        del_key(pressed[i]);
+    }
+    if (pressed_count) {
+        send_keyboard_report();
+    }
+    if (tapped_code != KC_NO) {
+        unregister_code(tapped_code);
+    }
+    while (step_mods(0)) {
+    }
+
+    head          = 0;
+    used          = 0;
+    in_string     = false;
+    waiting       = false;
+    pressed_count = 0;
+    tapped_code   = KC_NO;
+    dead_pending  = false;
+}
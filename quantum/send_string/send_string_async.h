@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/**
+ * \file
+ *
+ * \defgroup send_string_async Asynchronous Send String API
+ *
+ * \brief Types out strings from the main loop, without blocking the matrix scan.
+ *
+ * Strings are copied into a bounded queue, and typed one report at a time by
+ * send_string_async_task(). The format is the same as for send_string(),
+ * including the `SS_TAP()`, `SS_DOWN()`, `SS_UP()` and `SS_DELAY()` macros.
+ * \{
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "progmem.h"
+
+/**
+ * \brief Size of the queue in bytes. Each queued string takes its length plus two bytes.
+ */
+#ifndef SEND_STRING_ASYNC_BUFFER_SIZE
+#    define SEND_STRING_ASYNC_BUFFER_SIZE 128
+#endif
+
+/**
+ * \brief Queue a string to be typed out.
+ *
+ * The string is copied, so it does not need to outlive the call.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait between reports.
+ *
+ * \return false if the queue does not have room for the whole string, in which case nothing is queued
+ */
+bool send_string_async_with_delay(const char *string, uint8_t interval);
+
+/**
+ * \brief Queue a string to be typed out, with the default delay between reports.
+ *
+ * \param string The string to type out.
+ *
+ * \return false if the queue does not have room for the whole string
+ */
+bool send_string_async(const char *string);
+
+#if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string from PROGMEM to be typed out.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait between reports.
+ *
+ * \return false if the queue does not have room for the whole string
+ */
+bool send_string_async_with_delay_P(const char *string, uint8_t interval);
+#else
+#    define send_string_async_with_delay_P(string, interval) send_string_async_with_delay(string, interval)
+#endif
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), TAP_CODE_DELAY).
+ */
+#define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), TAP_CODE_DELAY)
+
+/**
+ * \brief Returns true while queued strings are still being typed out.
+ */
+bool send_string_async_busy(void);
+
+/**
+ * \brief Returns the number of bytes which can currently be queued.
+ */
+uint16_t send_string_async_free(void);
+
+/**
+ * \brief Discards all queued strings and releases any keys held by the engine.
+ */
+void send_string_async_cancel(void);
+
+/**
+ * \brief Types out the next report, if one is due. Called from the main loop.
+ */
+void send_string_async_task(void);
+
+/**
+ * \brief Returns the next time send_string_async_task() has work to do, in the timer_read32() time-space.
+ *
+ * \return false if nothing is queued
+ */
+bool send_string_async_next_deadline(uint32_t *deadline);
+
+/** \} */
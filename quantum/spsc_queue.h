@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * Lock-free single producer, single consumer queue.
+ *
+ * One context (e.g. a matrix scan or encoder interrupt) pushes, one context
+ * (the main loop) pops, and neither needs to mask interrupts. The producer only
+ * ever writes `head`, the consumer only ever writes `tail`; each publishes its
+ * index with release semantics after touching the slot, and reads the other's
+ * index with acquire semantics before touching the slot.
+ *
+ * The indices run freely and are masked on access, so the size must be a power
+ * of two and every slot is usable.
+ *
+ * Usage:
+ *
+ *     SPSC_QUEUE_DECLARE(my_queue, my_event_t, 16);
+ *     static my_queue_t queue;
+ *
+ *     my_queue_push(&queue, &event);   // producer
+ *     my_queue_pop(&queue, &event);    // consumer
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SPSC_LOAD_ACQUIRE(var) __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define SPSC_STORE_RELEASE(var, value) __atomic_store_n(&(var), (value), __ATOMIC_RELEASE)
+
+#define SPSC_QUEUE_SIZE_VALID(size) ((size) > 0 && (size) <= 128 && ((size) & ((size) - 1)) == 0)
+
+#define SPSC_QUEUE_DECLARE(name, type, size)                                                                      \
+    static_assert(SPSC_QUEUE_SIZE_VALID(size), #name ": size must be a power of two up to 128");                  \
+                                                                                                                  \
+    typedef struct name##_t {                                                                                     \
+        uint8_t head;                                                                                             \
+        uint8_t tail;                                                                                             \
+        type    items[size];                                                                                      \
+    } name##_t;                                                                                                   \
+                                                                                                                  \
+    /* Producer side: returns false, dropping the item, if the queue is full. */                                  \
+    static inline bool name##_push(name##_t *queue, const type *item) {                                           \
+        uint8_t head = queue->head;                                                                               \
+        if ((uint8_t)(head - SPSC_LOAD_ACQUIRE(queue->tail)) >= (size)) {                                         \
+            return false;                                                                                         \
+        }                                                                                                         \
+        queue->items[head & ((size) - 1)] = *item;                                                                \
+        SPSC_STORE_RELEASE(queue->head, (uint8_t)(head + 1));                                                     \
+        return true;                                                                                              \
+    }                                                                                                             \
+                                                                                                                  \
+    /* Consumer side: returns false if the queue is empty. */                                                     \
+    static inline bool name##_pop(name##_t *queue, type *item) {                                                  \
+        uint8_t tail = queue->tail;                                                                               \
+        if (tail == SPSC_LOAD_ACQUIRE(queue->head)) {                                                             \
+            return false;                                                                                         \
+        }                                                                                                         \
+        *item = queue->items[tail & ((size) - 1)];                                                                \
+        SPSC_STORE_RELEASE(queue->tail, (uint8_t)(tail + 1));                                                     \
+        return true;                                                                                              \
+    }                                                                                                             \
+                                                                                                                  \
+    /* Either side: a snapshot, which may be stale by the time it is used. */                                     \
+    static inline uint8_t name##_count(name##_t *queue) {                                                         \
+        return (uint8_t)(SPSC_LOAD_ACQUIRE(queue->head) - SPSC_LOAD_ACQUIRE(queue->tail));                        \
+    }                                                                                                             \
+                                                                                                                  \
+    /* Consumer side: discards everything pushed so far. */                                                       \
+    static inline void name##_drain(name##_t *queue) {                                                            \
+        SPSC_STORE_RELEASE(queue->tail, SPSC_LOAD_ACQUIRE(queue->head));                                          \
+    }
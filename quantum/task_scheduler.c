@@ -0,0 +1,96 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "task_scheduler.h"
+#include "timer.h"
+#include "print.h"
+
+static scheduled_task_t *tasks = NULL;
+
+bool task_scheduler_register(scheduled_task_t *task) {
+    if (!task || !task->task) {
+        return false;
+    }
+
+    scheduled_task_t **link = &tasks;
+    for (scheduled_task_t *t = tasks; t; t = t->next) {
+        if (t == task) {
+            return false;
+        }
+    }
+    // Keep the list sorted, equal priorities run in registration order
+    while (*link && (*link)->priority >= task->priority) {
+        link = &(*link)->next;
+    }
+
+    if (!task->profile.name) {
+        task->profile.name = task->name;
+    }
+    task->next     = *link;
+    task->last_run = timer_read32() - task->period;
+    *link          = task;
+    return true;
+}
+
+bool task_scheduler_unregister(scheduled_task_t *task) {
+    for (scheduled_task_t **link = &tasks; *link; link = &(*link)->next) {
+        if (*link == task) {
+            *link      = task->next;
+            task->next = NULL;
+            return true;
+        }
+    }
+    return false;
+}
+
+void task_scheduler_run(void) {
+    scheduled_task_t *next;
+    // Tasks may unregister themselves while running
+    for (scheduled_task_t *task = tasks; task; task = next) {
+        next = task->next;
+        if (task->period) {
+            uint32_t now = timer_read32();
+            if (TIMER_DIFF_32(now, task->last_run) < task->period) {
+                continue;
+            }
+            task->last_run = now;
+        }
+
+        uint32_t start = timer_read_stamp();
+        task->task();
+        uint32_t elapsed = timer_stamp_elapsed_us(start);
+
+        profiling_record(&task->profile, elapsed);
+        if (task->budget && elapsed > task->budget) {
+            ++task->overruns;
+        }
+    }
+}
+
+scheduled_task_t *task_scheduler_find(const char *name) {
+    for (scheduled_task_t *task = tasks; task; task = task->next) {
+        if (task->name && strcmp(task->name, name) == 0) {
+            return task;
+        }
+    }
+    return NULL;
+}
+
+scheduled_task_t *task_scheduler_tasks(void) {
+    return tasks;
+}
+
+void task_scheduler_clear_stats(void) {
+    for (scheduled_task_t *task = tasks; task; task = task->next) {
+        profiling_probe_clear(&task->profile);
+        task->overruns = 0;
+    }
+}
+
+void task_scheduler_print_stats(void) {
+    for (scheduled_task_t *task = tasks; task; task = task->next) {
+        uprintf("task %s: prio=%u period=%ums overruns=%lu\n", task->name ? task->name : "?", task->priority, task->period, (unsigned long)task->overruns);
+        profiling_probe_print("task", &task->profile);
+    }
+}
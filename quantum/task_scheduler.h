@@ -0,0 +1,69 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "profiling.h"
+
+/** \brief Minimum interval in milliseconds for built-in tasks which do not need to run on every loop. */
+#ifndef TASK_SCHEDULER_SLOW_TASK_PERIOD
+#    define TASK_SCHEDULER_SLOW_TASK_PERIOD 10
+#endif
+
+/* Priorities used by the built-in tasks, higher values run first. Tasks of
+ * equal priority run in registration order. A task which leaves `priority`
+ * unset gets TASK_PRIORITY_DEFAULT and runs after all of the built-in tasks. */
+#define TASK_PRIORITY_MATRIX 255
+#define TASK_PRIORITY_QUANTUM 128
+#define TASK_PRIORITY_KEYBOARD 64
+#define TASK_PRIORITY_DEFAULT 0
+
+/** \brief A periodic task run by the task scheduler.
+ *
+ * The storage is owned by the caller and must stay valid while the task is registered.
+ */
+typedef struct scheduled_task_t {
+    /* Configuration, may be changed at any time */
+    const char *name;
+    void (*task)(void);
+    uint16_t period;   // minimum interval between runs in milliseconds, 0 runs on every loop
+    uint16_t budget;   // expected worst case run time in microseconds, 0 disables overrun tracking
+    uint8_t  priority; // higher runs first, only read on registration
+
+    /* Statistics, see task_scheduler_clear_stats() */
+    profiling_probe_t profile;  // run count and run time distribution in microseconds, named after the task
+    uint32_t          overruns; // runs which took longer than `budget`
+
+    /* Internal state */
+    uint32_t                 last_run;
+    struct scheduled_task_t *next;
+} scheduled_task_t;
+
+/** \brief Adds a task to the scheduler.
+ *
+ * \return false if the task has no callback or is already registered
+ */
+bool task_scheduler_register(scheduled_task_t *task);
+
+/** \brief Removes a task from the scheduler.
+ *
+ * \return false if the task was not registered
+ */
+bool task_scheduler_unregister(scheduled_task_t *task);
+
+/** \brief Runs every registered task which is due, in priority order. */
+void task_scheduler_run(void);
+
+/** \brief Returns the registered task with the given name, or NULL. */
+scheduled_task_t *task_scheduler_find(const char *name);
+
+/** \brief Returns the highest priority registered task, follow `next` for the others. */
+scheduled_task_t *task_scheduler_tasks(void);
+
+/** \brief Resets the run count and timing statistics of all registered tasks. */
+void task_scheduler_clear_stats(void);
+
+/** \brief Prints the statistics of all registered tasks to the console. */
+void task_scheduler_print_stats(void);
@@ -316,19 +316,38 @@ static void send_nibble_wrapper(uint8_t digit) {
         uint8_t kc = digit < 10
                    ? KC_KP_1 + (10 + digit - 1) % 10
                    : KC_A + (digit - 10);
+#ifdef SEND_STRING_BULK_TYPING
+        if (TAP_CODE_DELAY == 0) {
+            send_string_bulk_tap_code(kc);
+            return;
+        }
+#endif
         tap_code(kc);
         return;
     }
+#ifdef SEND_STRING_BULK_TYPING
+    if (TAP_CODE_DELAY == 0) {
+        send_string_bulk_char(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        return;
+    }
+#endif
     send_nibble(digit);
 }
 
 // clang-format on
 
+static void send_nibble_flush(void) {
+#ifdef SEND_STRING_BULK_TYPING
+    send_string_bulk_flush();
+#endif
+}
+
 void register_hex(uint16_t hex) {
     for (int i = 3; i >= 0; i--) {
         uint8_t digit = ((hex >> (i * 4)) & 0xF);
         send_nibble_wrapper(digit);
     }
+    send_nibble_flush();
 }
 
 void register_hex32(uint32_t hex) {
@@ -354,6 +373,7 @@ void register_hex32(uint32_t hex) {
             first_digit = false;
         }
     }
+    send_nibble_flush();
 }
 
 void register_unicode(uint32_t code_point) {
@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "flash.h"
+#include "autocorrect_flash_mock.h"
+#include "autocorrect_flash_image.h"
+
+// Read only flash holding the dictionary image, counting every access
+uint32_t autocorrect_flash_mock_reads = 0;
+
+void flash_init(void) {}
+
+flash_status_t flash_is_busy(void) {
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
+    autocorrect_flash_mock_reads++;
+    memset(buf, 0xFF, len);
+    if (addr < sizeof(autocorrect_flash_image)) {
+        size_t available = sizeof(autocorrect_flash_image) - addr;
+        memcpy(buf, &autocorrect_flash_image[addr], len < available ? len : available);
+    }
+    return FLASH_STATUS_SUCCESS;
+}
@@ -0,0 +1,12 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+AUTOCORRECT_ENABLE = yes
+FLASH_DRIVER = custom
+
+# Paths from the repository root, so each test compiles these against its own config and image
+SRC += tests/autocorrect/autocorrect_flash_mock.c tests/autocorrect/test_autocorrect.cpp
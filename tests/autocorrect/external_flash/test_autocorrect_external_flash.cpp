@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "../autocorrect_flash_mock.h"
+
+using ::testing::_;
+
+// The tests shared with the other autocorrect configurations are built from ../test_autocorrect.cpp
+class AutoCorrectExternalFlash : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+
+    // Feeds a lowercase string straight to process_autocorrect, returning the number of keystrokes.
+    uint32_t Feed(const char *str) {
+        keyrecord_t record = {};
+        uint32_t    count  = 0;
+        for (; *str; ++str) {
+            uint16_t keycode      = *str == ' ' ? KC_SPC : KC_A + (*str - 'a');
+            record.event.pressed  = true;
+            record.event.type     = KEY_EVENT;
+            record.event.time     = timer_read() | 1;
+            record.event.key.row  = 0;
+            record.event.key.col  = 0;
+            process_autocorrect(keycode, &record);
+            count++;
+        }
+        return count;
+    }
+};
+
+// Test that the node cache keeps repeated lookups off the flash
+TEST_F(AutoCorrectExternalFlash, cache_avoids_flash_reads) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+
+    Feed("quick quick ");
+    uint32_t reads = autocorrect_flash_mock_reads;
+    Feed("quick quick ");
+    EXPECT_EQ(autocorrect_flash_mock_reads, reads);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Host side measurement of the per keystroke lookup cost, printed for comparison between builds
+TEST_F(AutoCorrectExternalFlash, Benchmark) {
+    TestDriver driver;
+    const char text[] = "the quick brown fox jumps over the lazy dog while a wizard quietly packs five dozen liquor jugs ";
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(0);
+
+    double   best      = 0;
+    uint32_t reads     = 0;
+    uint32_t keystroke = 0;
+    for (int run = 0; run < 5; run++) {
+        uint32_t start_reads = autocorrect_flash_mock_reads;
+        auto     start       = std::chrono::steady_clock::now();
+        keystroke            = 0;
+        for (int i = 0; i < 100; i++) {
+            keystroke += Feed(text);
+        }
+        auto   end = std::chrono::steady_clock::now();
+        double ns  = std::chrono::duration<double, std::nano>(end - start).count() / keystroke;
+        if (run == 0 || ns < best) {
+            best  = ns;
+            reads = autocorrect_flash_mock_reads - start_reads;
+        }
+    }
+    printf("autocorrect external flash: %.1f ns/keystroke, %.3f flash reads/keystroke\n", best, (double)reads / keystroke);
+
+    VERIFY_AND_CLEAR(driver);
+}
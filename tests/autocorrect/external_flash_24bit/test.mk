@@ -0,0 +1,12 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+AUTOCORRECT_ENABLE = yes
+FLASH_DRIVER = custom
+
+# Same tests as external_flash, against a dictionary image using 24-bit links
+SRC += tests/autocorrect/autocorrect_flash_mock.c tests/autocorrect/test_autocorrect.cpp tests/autocorrect/external_flash/test_autocorrect_external_flash.cpp
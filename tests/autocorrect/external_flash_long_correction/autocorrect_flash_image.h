@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Written by `qmk generate-autocorrect-data --external` from:
+//   fales      -> false
+//   accomodate -> accommodate, correctly spelled and well past forty chars
+static const uint8_t autocorrect_flash_image[] = {
+    0x51, 0x41, 0x43, 0x02, 0x02, 0x05, 0x0A, 0x38, 0x4F, 0x00, 0x00, 0x00, 0x48, 0x07, 0x00,
+    0x16, 0x46, 0x00, 0x00, 0x17, 0x04, 0x07, 0x12, 0x10, 0x12, 0x06, 0x06, 0x04, 0x00, 0x84,
+    0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x63, 0x74,
+    0x6C, 0x79, 0x20, 0x73, 0x70, 0x65, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x77, 0x65, 0x6C, 0x6C, 0x20, 0x70, 0x61, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x74, 0x79,
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x00, 0x08, 0x0F, 0x04, 0x09, 0x00, 0x81, 0x73, 0x65,
+    0x00,
+};
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+AUTOCORRECT_ENABLE = yes
+FLASH_DRIVER = custom
+
+SRC += tests/autocorrect/autocorrect_flash_mock.c
@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using ::testing::_;
+
+#define LONGEST_CORRECTION "accommodate, correctly spelled and well past forty chars"
+
+static int         corrections = 0;
+static std::string corrected;
+
+// Records the corrected word instead of typing it
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    corrections++;
+    corrected = correct;
+    return false;
+}
+
+class AutoCorrectLongCorrection : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        corrections = 0;
+        corrected.clear();
+    }
+
+    // Feeds a lowercase string straight to process_autocorrect
+    void Feed(const char *str) {
+        keyrecord_t record = {};
+        for (; *str; ++str) {
+            record.event.pressed = true;
+            record.event.type    = KEY_EVENT;
+            record.event.time    = timer_read() | 1;
+            process_autocorrect(KC_A + (*str - 'a'), &record);
+        }
+    }
+};
+
+#if AUTOCORRECT_MAX_CORRECTION_LENGTH >= 56
+// Test that a correction longer than the typo buffer is passed on in full
+TEST_F(AutoCorrectLongCorrection, correction_is_not_truncated) {
+    Feed("accomodate");
+
+    EXPECT_EQ(corrections, 1);
+    EXPECT_EQ(corrected, LONGEST_CORRECTION);
+}
+#else
+// Test that a dictionary with corrections longer than AUTOCORRECT_MAX_CORRECTION_LENGTH is not used
+TEST_F(AutoCorrectLongCorrection, dictionary_is_rejected) {
+    Feed("accomodate");
+    Feed("fales");
+
+    EXPECT_EQ(corrections, 0);
+}
+#endif
@@ -0,0 +1,6 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../autocorrect_flash_image.h"
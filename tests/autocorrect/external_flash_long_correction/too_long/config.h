@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define AUTOCORRECT_EXTERNAL_FLASH
+// One less than the longest correction in the dictionary
+#define AUTOCORRECT_MAX_CORRECTION_LENGTH 55
@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+AUTOCORRECT_ENABLE = yes
+FLASH_DRIVER = custom
+
+# Same tests, with a limit the dictionary does not fit in
+SRC += tests/autocorrect/autocorrect_flash_mock.c tests/autocorrect/external_flash_long_correction/test_autocorrect_long_correction.cpp
@@ -0,0 +1,134 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+extern "C" {
+/* Lets the tests shrink the active combo set, as a dynamic combo implementation would. */
+uint16_t index_combo_count = 0;
+
+uint16_t combo_count(void) {
+    return index_combo_count;
+}
+
+std::vector<uint16_t> fired_combos;
+
+void process_combo_event(uint16_t combo_index, bool pressed) {
+    if (pressed) {
+        fired_combos.push_back(combo_index);
+    }
+}
+}
+
+static uint16_t letter_for(uint16_t n) {
+    return KC_A + n % 26;
+}
+
+static uint16_t function_key_for(uint16_t n) {
+    return n / 26 < 12 ? KC_F1 + n / 26 : KC_F13 + n / 26 - 12;
+}
+
+class ComboIndex : public TestFixture {
+   public:
+    ComboIndex() {
+        fired_combos.clear();
+        index_combo_count = combo_count_raw();
+        combo_key_index_invalidate();
+    }
+};
+
+TEST_F(ComboIndex, EveryComboIsReachable) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    for (uint16_t n = 0; n < combo_count(); n += 7) {
+        auto letter       = KeymapKey(0, 0, 0, letter_for(n));
+        auto function_key = KeymapKey(0, 1, 0, function_key_for(n));
+        set_keymap({letter, function_key});
+
+        fired_combos.clear();
+        tap_combo({letter, function_key});
+        ASSERT_EQ(fired_combos.size(), 1) << "combo " << n;
+        EXPECT_EQ(fired_combos[0], n);
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, KeysOutsideAnyComboPassThrough) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_1);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(fired_combos.empty());
+}
+
+TEST_F(ComboIndex, IndexFollowsComboCount) {
+    TestDriver driver;
+    const uint16_t n            = 377;
+    auto           letter       = KeymapKey(0, 0, 0, letter_for(n));
+    auto           function_key = KeymapKey(0, 1, 0, function_key_for(n));
+
+    set_keymap({letter, function_key});
+
+    /* With the combo dropped from the active set the keys are typed normally. */
+    index_combo_count = n;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(letter.code))).Times(1);
+    tap_combo({letter, function_key});
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(fired_combos.empty());
+
+    index_combo_count = n + 1;
+    EXPECT_NO_REPORT(driver);
+    tap_combo({letter, function_key});
+    VERIFY_AND_CLEAR(driver);
+    ASSERT_EQ(fired_combos.size(), 1);
+    EXPECT_EQ(fired_combos[0], n);
+}
+
+TEST_F(ComboIndex, PerEventCostBenchmark) {
+    TestDriver driver;
+    const int  iterations = 2000;
+
+    set_keymap({KeymapKey(0, 0, 0, KC_1)});
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    keyrecord_t record = {};
+    record.event.type  = KEY_EVENT;
+
+    for (uint16_t count : {25, 50, 100, 200, 400}) {
+        index_combo_count = count;
+        combo_key_index_invalidate();
+
+        /* A key outside every combo, and the first key of the last combo. */
+        for (uint16_t keycode : {(uint16_t)KC_1, letter_for(count - 1)}) {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                record.event.pressed = true;
+                process_combo(keycode, &record);
+                record.event.pressed = false;
+                process_combo(keycode, &record);
+            }
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            printf("combos=%3u keycode=0x%04X: %lld ns/event\n", count, keycode, (long long)(elapsed / (iterations * 2)));
+        }
+    }
+    VERIFY_AND_CLEAR(driver);
+}
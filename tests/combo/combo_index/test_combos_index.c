@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+/* Combo n is made of a letter (KC_A + n % 26) and a function key (F1 + n / 26), so every pair is unique. */
+#define COMBO_SECOND_KEY(n) ((n) / 26 < 12 ? KC_F1 + (n) / 26 : KC_F13 + (n) / 26 - 12)
+#define COMBO_KEYS(n) {KC_A + (n) % 26, COMBO_SECOND_KEY(n), COMBO_END},
+#define COMBO_ENTRY(n) COMBO_ACTION(index_combo_keys[n]),
+
+#define REPEAT_10(m, n) m((n) + 0) m((n) + 1) m((n) + 2) m((n) + 3) m((n) + 4) m((n) + 5) m((n) + 6) m((n) + 7) m((n) + 8) m((n) + 9)
+#define REPEAT_100(m, n) REPEAT_10(m, (n) + 0) REPEAT_10(m, (n) + 10) REPEAT_10(m, (n) + 20) REPEAT_10(m, (n) + 30) REPEAT_10(m, (n) + 40) REPEAT_10(m, (n) + 50) REPEAT_10(m, (n) + 60) REPEAT_10(m, (n) + 70) REPEAT_10(m, (n) + 80) REPEAT_10(m, (n) + 90)
+#define REPEAT_400(m) REPEAT_100(m, 0) REPEAT_100(m, 100) REPEAT_100(m, 200) REPEAT_100(m, 300)
+
+uint16_t const index_combo_keys[][3] = {REPEAT_400(COMBO_KEYS)};
+
+// clang-format off
+combo_t key_combos[] = {
+    REPEAT_400(COMBO_ENTRY)
+};
+// clang-format on
+
@@ -0,0 +1,5 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The heap backend must behave exactly like the default backend, so run the same tests against it.
+#include "../test_deferred_exec.cpp"
@@ -0,0 +1,257 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+struct recorded_call {
+    uint32_t trigger_time;
+    uintptr_t id;
+};
+
+static std::vector<recorded_call> calls;
+static uint32_t                   repeat_delay = 0;
+
+#define TABLE_COUNT 4
+static deferred_executor_t table[TABLE_COUNT];
+static uint32_t            last_execution;
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    calls.push_back({trigger_time, (uintptr_t)cb_arg});
+    return repeat_delay;
+}
+
+/* Uses a private table, so the executor state does not leak between tests while the fixture resets the timer. */
+class DeferredExec : public TestFixture {
+   public:
+    DeferredExec() {
+        calls.clear();
+        repeat_delay = 0;
+        memset(table, 0, sizeof(table));
+        last_execution = timer_read32();
+    }
+
+    deferred_token defer(uint32_t delay_ms, uintptr_t id) {
+        return defer_exec_advanced(table, TABLE_COUNT, delay_ms, record_callback, (void *)id);
+    }
+
+    bool extend(deferred_token token, uint32_t delay_ms) {
+        return extend_deferred_exec_advanced(table, TABLE_COUNT, token, delay_ms);
+    }
+
+    bool cancel(deferred_token token) {
+        return cancel_deferred_exec_advanced(table, TABLE_COUNT, token);
+    }
+
+    bool next_deadline(uint32_t *deadline) {
+        return deferred_exec_advanced_next_deadline(table, TABLE_COUNT, deadline);
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, TABLE_COUNT, &last_execution);
+        }
+    }
+
+    std::vector<uintptr_t> ids() {
+        std::vector<uintptr_t> result;
+        for (auto &call : calls) {
+            result.push_back(call.id);
+        }
+        return result;
+    }
+};
+
+TEST_F(DeferredExec, ExecutesInTriggerOrder) {
+    uint32_t start = timer_read32();
+    defer(30, 3);
+    defer(10, 1);
+    defer(20, 2);
+
+    run_for(9);
+    EXPECT_TRUE(calls.empty());
+
+    run_for(30);
+    EXPECT_EQ(ids(), (std::vector<uintptr_t>{1, 2, 3}));
+    EXPECT_EQ(calls[0].trigger_time, start + 10);
+    EXPECT_EQ(calls[2].trigger_time, start + 30);
+}
+
+TEST_F(DeferredExec, NextDeadlineTracksEarliestExecutor) {
+    uint32_t start = timer_read32();
+    uint32_t deadline;
+
+    EXPECT_FALSE(next_deadline(&deadline));
+
+    defer(50, 1);
+    deferred_token early = defer(20, 2);
+    ASSERT_TRUE(next_deadline(&deadline));
+    EXPECT_EQ(deadline, start + 20);
+
+    EXPECT_TRUE(extend(early, 80));
+    ASSERT_TRUE(next_deadline(&deadline));
+    EXPECT_EQ(deadline, start + 50);
+
+    EXPECT_TRUE(cancel(early));
+    run_for(50);
+    EXPECT_EQ(ids(), (std::vector<uintptr_t>{1}));
+    EXPECT_FALSE(next_deadline(&deadline));
+}
+
+TEST_F(DeferredExec, BasicApiReportsNextDeadline) {
+    uint32_t       start = timer_read32();
+    uint32_t       deadline;
+    deferred_token token = defer_exec(25, record_callback, NULL);
+
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    ASSERT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, start + 25);
+
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    EXPECT_FALSE(deferred_exec_next_deadline(&deadline));
+}
+
+TEST_F(DeferredExec, RepeatingExecutorIsRequeuedFromTriggerTime) {
+    uint32_t start = timer_read32();
+    repeat_delay   = 10;
+    defer(5, 1);
+
+    run_for(30);
+    ASSERT_EQ(calls.size(), 3);
+    EXPECT_EQ(calls[0].trigger_time, start + 5);
+    EXPECT_EQ(calls[1].trigger_time, start + 15);
+    EXPECT_EQ(calls[2].trigger_time, start + 25);
+}
+
+TEST_F(DeferredExec, CancelledTokensCannotBeReused) {
+    deferred_token first = defer(10, 1);
+    EXPECT_TRUE(cancel(first));
+    EXPECT_FALSE(cancel(first));
+    EXPECT_FALSE(extend(first, 10));
+
+    deferred_token second = defer(10, 2);
+    EXPECT_NE(second, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(second, first);
+    EXPECT_FALSE(cancel(first));
+
+    run_for(10);
+    EXPECT_EQ(ids(), (std::vector<uintptr_t>{2}));
+}
+
+#ifdef DEFERRED_EXEC_HEAP
+TEST_F(DeferredExec, StaleTokenDoesNotCancelReusedEntry) {
+    deferred_token stale = defer(10, 1);
+    EXPECT_TRUE(cancel(stale));
+
+    /* Each pass claims the entry the stale token referred to, the 256th claim below is the last before it may match again */
+    for (int i = 0; i < 254; i++) {
+        deferred_token token = defer(10, 2);
+        ASSERT_NE(token, stale);
+        EXPECT_FALSE(cancel(stale));
+        EXPECT_TRUE(cancel(token));
+    }
+
+    deferred_token token = defer(10, 3);
+    EXPECT_FALSE(cancel(stale));
+    EXPECT_FALSE(extend(stale, 20));
+
+    run_for(10);
+    EXPECT_EQ(ids(), (std::vector<uintptr_t>{3}));
+    EXPECT_FALSE(cancel(token));
+}
+#endif
+
+TEST_F(DeferredExec, TableFull) {
+    for (uintptr_t i = 0; i < TABLE_COUNT; i++) {
+        EXPECT_NE(defer(10 + i, i), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(5, 98), INVALID_DEFERRED_TOKEN);
+
+    run_for(10);
+    EXPECT_EQ(ids(), (std::vector<uintptr_t>{0}));
+    EXPECT_NE(defer(1, 99), INVALID_DEFERRED_TOKEN);
+}
+
+static deferred_token other_token;
+
+static uint32_t cancel_other_callback(uint32_t trigger_time, void *cb_arg) {
+    calls.push_back({trigger_time, (uintptr_t)cb_arg});
+    cancel_deferred_exec_advanced(table, TABLE_COUNT, other_token);
+    return 0;
+}
+
+TEST_F(DeferredExec, CallbackMayCancelOtherExecutors) {
+    defer_exec_advanced(table, TABLE_COUNT, 10, cancel_other_callback, (void *)1);
+    other_token = defer(10, 2);
+    defer(11, 3);
+
+    run_for(20);
+    EXPECT_EQ(ids(), (std::vector<uintptr_t>{1, 3}));
+}
+
+static uint32_t bench_calls = 0;
+static uint32_t bench_period_base;
+static uint32_t bench_period_step;
+
+static uint32_t periodic_callback(uint32_t trigger_time, void *cb_arg) {
+    bench_calls++;
+    return bench_period_base + bench_period_step * (uintptr_t)cb_arg;
+}
+
+/* Every executor repeats with a different period; prints the average cost of one deferred_exec_advanced_task() tick. */
+static void benchmark_table(const char *scenario, uint32_t period_base, uint32_t period_step) {
+    static const size_t count = 48;
+    deferred_executor_t table[count];
+    uint32_t            last_execution = timer_read32();
+
+    memset(table, 0, sizeof(table));
+    bench_calls       = 0;
+    bench_period_base = period_base;
+    bench_period_step = period_step;
+
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_NE(defer_exec_advanced(table, count, period_base + period_step * i, periodic_callback, (void *)i), INVALID_DEFERRED_TOKEN);
+    }
+
+    const int iterations = 100000;
+    auto      start      = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        advance_time(1);
+        deferred_exec_advanced_task(table, count, &last_execution);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+#ifdef DEFERRED_EXEC_HEAP
+    const char *backend = "heap";
+#else
+    const char *backend = "linear";
+#endif
+    printf("deferred_exec %-6s %-6s: %zu executors, %6lu callbacks, %lld ns/tick\n", backend, scenario, count, (unsigned long)bench_calls, (long long)(elapsed / iterations));
+    EXPECT_GT(bench_calls, 0);
+
+    for (size_t i = 0; i < count; i++) {
+        if (table[i].token != INVALID_DEFERRED_TOKEN) {
+            EXPECT_TRUE(cancel_deferred_exec_advanced(table, count, table[i].token));
+        }
+    }
+    uint32_t deadline;
+    EXPECT_FALSE(deferred_exec_advanced_next_deadline(table, count, &deadline));
+}
+
+TEST_F(DeferredExec, BenchmarkMostlyIdle) {
+    benchmark_table("idle", 500, 10);
+}
+
+TEST_F(DeferredExec, BenchmarkBusy) {
+    benchmark_table("busy", 10, 1);
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TEST_EEPROM_BYTE_COUNT 512
+#define DYNAMIC_KEYMAP_LAYER_COUNT 1
+#define DYNAMIC_KEYMAP_MACRO_COUNT 4
+#define DYNAMIC_KEYMAP_MACRO_READ_SIZE 8
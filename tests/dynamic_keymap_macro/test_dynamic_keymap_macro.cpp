@@ -0,0 +1,88 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+class DynamicKeymapMacro : public TestFixture {
+   protected:
+    DynamicKeymapMacro() {
+        dynamic_keymap_macro_reset();
+    }
+
+    /* Writes the macros back to back, the buffer is only valid once the last byte is zero */
+    void set_macros(const std::string &macros) {
+        std::vector<uint8_t> data(macros.begin(), macros.end());
+        data.push_back(0);
+        dynamic_keymap_macro_set_buffer(0, data.size(), data.data());
+    }
+
+    /* Returns the keys pressed while sending a macro */
+    std::vector<uint8_t> send(TestDriver &driver, uint8_t id) {
+        std::vector<uint8_t> pressed;
+        uint8_t              previous = KC_NO;
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            if (report.keys[0] != KC_NO && report.keys[0] != previous) {
+                pressed.push_back(report.keys[0]);
+            }
+            previous = report.keys[0];
+        }));
+        dynamic_keymap_macro_send(id);
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return pressed;
+    }
+};
+
+TEST_F(DynamicKeymapMacro, SendsNthMacro) {
+    TestDriver driver;
+
+    set_macros(std::string("ab\0cd\0\0ef", 9));
+    EXPECT_EQ(send(driver, 0), (std::vector<uint8_t>{KC_A, KC_B}));
+    EXPECT_EQ(send(driver, 1), (std::vector<uint8_t>{KC_C, KC_D}));
+    EXPECT_EQ(send(driver, 2), (std::vector<uint8_t>{}));
+    EXPECT_EQ(send(driver, 3), (std::vector<uint8_t>{KC_E, KC_F}));
+}
+
+TEST_F(DynamicKeymapMacro, MissingMacroSendsNothing) {
+    TestDriver driver;
+
+    set_macros("ab");
+    EXPECT_EQ(send(driver, 1), (std::vector<uint8_t>{}));
+    EXPECT_EQ(send(driver, 3), (std::vector<uint8_t>{}));
+}
+
+TEST_F(DynamicKeymapMacro, MacrosSpanReadChunks) {
+    TestDriver driver;
+
+    /* The tap sequence straddles the boundary of the second chunk */
+    set_macros(std::string("abcdefg\0hijkl" SS_TAP(X_ENTER) "mnopqrstu", 25));
+    EXPECT_EQ(send(driver, 1), (std::vector<uint8_t>{KC_H, KC_I, KC_J, KC_K, KC_L, KC_ENTER, KC_M, KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T, KC_U}));
+}
+
+TEST_F(DynamicKeymapMacro, WritingMacrosUpdatesOffsets) {
+    TestDriver driver;
+
+    set_macros(std::string("a\0b", 3));
+    EXPECT_EQ(send(driver, 1), (std::vector<uint8_t>{KC_B}));
+
+    set_macros(std::string("aaa\0c", 5));
+    EXPECT_EQ(send(driver, 1), (std::vector<uint8_t>{KC_C}));
+
+    dynamic_keymap_macro_reset();
+    EXPECT_EQ(send(driver, 1), (std::vector<uint8_t>{}));
+}
+
+TEST_F(DynamicKeymapMacro, IncompleteBufferIsIgnored) {
+    TestDriver driver;
+
+    set_macros("ab");
+    uint8_t busy = 0xFF;
+    dynamic_keymap_macro_set_buffer(dynamic_keymap_macro_get_buffer_size() - 1, 1, &busy);
+    EXPECT_EQ(send(driver, 0), (std::vector<uint8_t>{}));
+}
@@ -0,0 +1,161 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class KeyActionCache : public TestFixture {
+   protected:
+    void TearDown() override {
+        keymap_config.swap_lctl_lgui = false;
+        TestFixture::TearDown();
+    }
+
+    void replace_keycode(uint8_t layer, keypos_t position, uint16_t code) {
+        /* Bypasses add_key() on purpose, so the cache is not invalidated. */
+        std::vector<KeymapKey> rebuilt;
+        for (const auto& key : keymap) {
+            if (key.layer != layer || !KEYEQ(key.position, position)) {
+                rebuilt.push_back(key);
+            }
+        }
+        rebuilt.push_back(KeymapKey(layer, position.col, position.row, code));
+        keymap.swap(rebuilt);
+    }
+};
+
+TEST_F(KeyActionCache, KeysSendTheirKeycodes) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_key   = KeymapKey(0, 0, 0, MO(1));
+    auto       regular_key = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({layer_key, regular_key, KeymapKey(1, 1, 0, KC_B)});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyActionCache, LookupsDoNotTouchKeymapOnceCached) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_EQ(action_for_key(0, key.position).code, action_for_keycode(KC_A).code);
+
+    /* Change the keymap behind the cache's back: the stale result proves the keymap was not consulted. */
+    replace_keycode(0, key.position, KC_B);
+    EXPECT_EQ(action_for_key(0, key.position).code, action_for_keycode(KC_A).code);
+
+    key_action_cache_invalidate();
+    EXPECT_EQ(action_for_key(0, key.position).code, action_for_keycode(KC_B).code);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyActionCache, SingleKeyUpdate) {
+    TestDriver driver;
+    auto       key   = KeymapKey(0, 0, 0, KC_A);
+    auto       other = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key, other});
+
+    EXPECT_EQ(action_for_key(0, key.position).code, action_for_keycode(KC_A).code);
+    EXPECT_EQ(action_for_key(0, other.position).code, action_for_keycode(KC_B).code);
+
+    /* Only the invalidated key is read from the keymap again. */
+    replace_keycode(0, key.position, MO(2));
+    replace_keycode(0, other.position, KC_C);
+    key_action_cache_invalidate_key(0, key.position);
+    EXPECT_EQ(action_for_key(0, key.position).code, action_for_keycode(MO(2)).code);
+    EXPECT_EQ(action_for_key(0, other.position).code, action_for_keycode(KC_B).code);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyActionCache, LayersAboveCacheAreNotCached) {
+    TestDriver driver;
+    auto       key = KeymapKey(5, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_EQ(action_for_key(5, key.position).code, action_for_keycode(KC_A).code);
+    replace_keycode(5, key.position, KC_B);
+    EXPECT_EQ(action_for_key(5, key.position).code, action_for_keycode(KC_B).code);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyActionCache, KeymapConfigChangeRefreshesCache) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_LCTL);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    keymap_config.swap_lctl_lgui = true;
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Host side measurement of the lookup cost, printed for comparison between builds
+TEST_F(KeyActionCache, Benchmark) {
+    TestDriver driver;
+
+    set_keymap({KeymapKey(0, 0, 0, KC_A), KeymapKey(0, 1, 0, LT(1, KC_SPC)), KeymapKey(0, 2, 0, LSFT_T(KC_F)), KeymapKey(0, 3, 0, MO(2)), KeymapKey(1, 0, 0, C(KC_Z)), KeymapKey(1, 1, 0, KC_TRNS), KeymapKey(1, 2, 0, OSM(MOD_LSFT)), KeymapKey(1, 3, 0, KC_ESC)});
+
+    const uint32_t lookups = 2000 * 2 * 4;
+    double         best[2] = {0, 0};
+    for (int run = 0; run < 5; run++) {
+        for (int cached = 0; cached < 2; cached++) {
+            uint32_t sum   = 0;
+            auto     start = std::chrono::steady_clock::now();
+            for (int i = 0; i < 2000; i++) {
+                for (uint8_t layer = 0; layer < 2; layer++) {
+                    for (uint8_t col = 0; col < 4; col++) {
+                        keypos_t key = {.col = col, .row = 0};
+                        sum += cached ? action_for_key(layer, key).code : action_for_keycode(keymap_key_to_keycode(layer, key)).code;
+                    }
+                }
+            }
+            auto   end = std::chrono::steady_clock::now();
+            double ns  = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+            EXPECT_GT(sum, 0);
+            if (run == 0 || ns < best[cached]) {
+                best[cached] = ns;
+            }
+        }
+    }
+    printf("action_for_key: %.1f ns/lookup uncached, %.1f ns/lookup cached\n", best[0], best[1]);
+
+    VERIFY_AND_CLEAR(driver);
+}
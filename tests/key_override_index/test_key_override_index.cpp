@@ -0,0 +1,141 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class KeyOverrideIndex : public TestFixture {
+   public:
+    KeyOverrideIndex() {
+        key_override_index_invalidate();
+    }
+};
+
+TEST_F(KeyOverrideIndex, FirstMatchingTriggerWins) {
+    TestDriver driver;
+    InSequence s;
+    auto       shift = KeymapKey(0, 0, 0, KC_LSFT);
+    auto       bspc  = KeymapKey(0, 1, 0, KC_BSPC);
+
+    set_keymap({shift, bspc});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    bspc.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, SameTriggerDifferentMods) {
+    TestDriver driver;
+    InSequence s;
+    auto       ctrl = KeymapKey(0, 0, 0, KC_LCTL);
+    auto       bspc = KeymapKey(0, 1, 0, KC_BSPC);
+
+    set_keymap({ctrl, bspc});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    ctrl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_INS));
+    bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    bspc.release();
+    run_one_scan_loop();
+    ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, LateOverrideIsFound) {
+    TestDriver driver;
+    InSequence s;
+    auto       gui    = KeymapKey(0, 0, 0, KC_LGUI);
+    auto       letter = KeymapKey(0, 1, 0, KC_W);
+
+    set_keymap({gui, letter});
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    gui.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Filler override 100 is GUI + W -> 1. */
+    EXPECT_REPORT(driver, (KC_1));
+    letter.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    EXPECT_EMPTY_REPORT(driver);
+    letter.release();
+    run_one_scan_loop();
+    gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, UnmodifiedKeysPassThrough) {
+    TestDriver driver;
+    InSequence s;
+    auto       bspc = KeymapKey(0, 0, 0, KC_BSPC);
+
+    set_keymap({bspc});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(bspc);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideIndex, ModifierOnlyOverride) {
+    TestDriver driver;
+    InSequence s;
+    auto       gui = KeymapKey(0, 0, 0, KC_LGUI);
+    auto       alt = KeymapKey(0, 1, 0, KC_LALT);
+
+    set_keymap({gui, alt});
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    gui.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The replacement is deferred by the 500ms key repeat delay, with both trigger mods suppressed. */
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_F13));
+    alt.press();
+    idle_for(600);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    alt.release();
+    run_one_scan_loop();
+    gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
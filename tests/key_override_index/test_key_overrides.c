@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+const key_override_t shift_backspace_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t ctrl_backspace_override  = ko_make_basic(MOD_MASK_CTRL, KC_BSPC, KC_INS);
+const key_override_t shift_backspace_shadowed = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_HOME);
+const key_override_t gui_alt_override         = ko_make_basic(MOD_BIT(KC_LGUI) | MOD_BIT(KC_LALT), KC_NO, KC_F13);
+
+/* Filler override n is triggered by a letter and a single modifier, so every pair is unique. */
+#define FILLER_OVERRIDE(n) ko_make_basic(1 << ((n) / 26), KC_A + (n) % 26, KC_1 + (n) % 10),
+#define FILLER_POINTER(n) &filler_overrides[n],
+
+#define REPEAT_8(m, n) m((n) + 0) m((n) + 1) m((n) + 2) m((n) + 3) m((n) + 4) m((n) + 5) m((n) + 6) m((n) + 7)
+#define REPEAT_104(m) REPEAT_8(m, 0) REPEAT_8(m, 8) REPEAT_8(m, 16) REPEAT_8(m, 24) REPEAT_8(m, 32) REPEAT_8(m, 40) REPEAT_8(m, 48) REPEAT_8(m, 56) REPEAT_8(m, 64) REPEAT_8(m, 72) REPEAT_8(m, 80) REPEAT_8(m, 88) REPEAT_8(m, 96)
+
+const key_override_t filler_overrides[] = {REPEAT_104(FILLER_OVERRIDE)};
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &shift_backspace_override,
+    &ctrl_backspace_override,
+    &shift_backspace_shadowed,
+    &gui_alt_override,
+    REPEAT_104(FILLER_POINTER)
+};
+// clang-format on
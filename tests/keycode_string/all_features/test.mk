@@ -0,0 +1,19 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Every feature with entries in the common names table, so all of them are checked
+EXTRAKEY_ENABLE = yes
+KEYCODE_STRING_ENABLE = yes
+KEY_LOCK_ENABLE = yes
+MAGIC_ENABLE = yes
+MOUSEKEY_ENABLE = yes
+PROGRAMMABLE_BUTTON_ENABLE = yes
+SECURE_ENABLE = yes
+SWAP_HANDS_ENABLE = yes
+GRAVE_ESC_ENABLE = yes
+LEADER_ENABLE = yes
+CAPS_WORD_ENABLE = yes
+TRI_LAYER_ENABLE = yes
+LAYER_LOCK_ENABLE = yes
+
+SRC += ../test_keycode_string.cpp
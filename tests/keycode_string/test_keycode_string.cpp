@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <cstdio>
 #include <iostream>
 
 #include "test_common.hpp"
@@ -19,6 +21,8 @@
 enum {
     MYMACRO1 = SAFE_RANGE,
     MYMACRO2,
+    // Past the user range keycodes checked below
+    MYMACRO3 = QK_USER_16,
 };
 
 // clang-format off
@@ -26,6 +30,7 @@ extern "C" {
 
 KEYCODE_STRING_NAMES_KB(
     KEYCODE_STRING_NAME(MYMACRO1),
+    KEYCODE_STRING_NAME(MYMACRO3),
 );
 
 KEYCODE_STRING_NAMES_USER(
@@ -146,8 +151,39 @@ TEST_F(KeycodeStringTest, get_keycode_string) {
              // Custom keycode names.
              {MYMACRO1, "MYMACRO1"},
              {MYMACRO2, "MYMACRO2"},
+             {MYMACRO3, "MYMACRO3"},
              {KC_EXLM, "KC_EXLM"},
          })) {
         EXPECT_EQ(get_keycode_string(keycode), expected) << "where keycode = 0x" << std::hex << keycode;
     }
 }
+
+TEST_F(KeycodeStringTest, CommonNamesAreSorted) {
+    EXPECT_TRUE(keycode_string_common_names_sorted());
+}
+
+// Host side measurement of the lookup cost, printed for comparison between builds
+TEST_F(KeycodeStringTest, Benchmark) {
+    const uint16_t keycodes[] = {KC_A, KC_ENT, KC_SPC, KC_LSFT, KC_F5, KC_1, MS_WHLD, SE_REQ, MYMACRO2, LT(1, KC_ESC), LSFT_T(KC_F), C(KC_Z)};
+    uint32_t       lookups    = 0;
+    double         best       = 0;
+
+    for (int run = 0; run < 5; run++) {
+        size_t total = 0;
+        auto   start = std::chrono::steady_clock::now();
+        lookups      = 0;
+        for (int i = 0; i < 2000; i++) {
+            for (uint16_t keycode : keycodes) {
+                total += strlen(get_keycode_string(keycode));
+                lookups++;
+            }
+        }
+        auto   end = std::chrono::steady_clock::now();
+        double ns  = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+        EXPECT_GT(total, 0);
+        if (run == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    printf("get_keycode_string: %.1f ns/lookup\n", best);
+}
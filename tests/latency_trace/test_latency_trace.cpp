@@ -0,0 +1,165 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" void advance_time(uint32_t ms);
+
+using testing::_;
+using testing::InSequence;
+
+class LatencyTrace : public TestFixture {
+   public:
+    LatencyTrace() {
+        latency_trace_clear();
+    }
+};
+
+TEST_F(LatencyTrace, PlainKeyIsTracedThroughAllStages) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        const profiling_probe_t *h = latency_trace_get_probe((latency_stage_t)stage);
+        EXPECT_EQ(h->count, 2) << latency_trace_stage_name((latency_stage_t)stage);
+        EXPECT_EQ(h->max, 0) << latency_trace_stage_name((latency_stage_t)stage);
+        EXPECT_EQ(h->buckets[0], 2) << latency_trace_stage_name((latency_stage_t)stage);
+    }
+}
+
+TEST_F(LatencyTrace, TapHoldDelayIsAttributedToTappingStage) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, LSFT_T(KC_A));
+
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const profiling_probe_t *tapping = latency_trace_get_probe(LATENCY_STAGE_TAPPING);
+    EXPECT_EQ(tapping->count, 2);
+    EXPECT_EQ(tapping->min, 0);
+    EXPECT_EQ(tapping->max, 50000);
+
+    const profiling_probe_t *total = latency_trace_get_probe(LATENCY_STAGE_TOTAL);
+    EXPECT_EQ(total->count, 2);
+    EXPECT_EQ(total->max, 50000);
+
+    const profiling_probe_t *process = latency_trace_get_probe(LATENCY_STAGE_PROCESS_RECORD);
+    EXPECT_EQ(process->max, 0);
+}
+
+TEST_F(LatencyTrace, EventsWithoutReportsAreDiscarded) {
+    TestDriver driver;
+    auto       layer_key   = KeymapKey(0, 0, 0, MO(1));
+    auto       regular_key = KeymapKey(1, 1, 0, KC_B);
+
+    set_keymap({layer_key, regular_key, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(0, 1, 0, KC_C)});
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const profiling_probe_t *total = latency_trace_get_probe(LATENCY_STAGE_TOTAL);
+    EXPECT_EQ(total->count, 1);
+    EXPECT_EQ(total->max, 0);
+
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(total->count, 2);
+}
+
+TEST_F(LatencyTrace, RawHidPacketContainsHistogram) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    uint8_t data[32] = {0xAA, LATENCY_STAGE_TOTAL, 0};
+    EXPECT_TRUE(latency_trace_raw_hid_fill(data, sizeof(data)));
+    EXPECT_EQ(data[0], 0xAA);
+    EXPECT_EQ(data[3], PROFILING_HISTOGRAM_BUCKETS);
+    EXPECT_EQ(data[4], 2);
+    EXPECT_EQ(data[24], 2);
+    EXPECT_EQ(data[25], 0);
+
+    data[1] = LATENCY_STAGE_COUNT;
+    EXPECT_FALSE(latency_trace_raw_hid_fill(data, sizeof(data)));
+}
+
+TEST_F(LatencyTrace, PendingTapHoldKeepsItsSlot) {
+    TestDriver driver;
+    auto       hold_key = KeymapKey(0, 0, 0, LSFT_T(KC_A));
+    auto       key_b    = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c    = KeymapKey(0, 2, 0, KC_C);
+    auto       key_d    = KeymapKey(0, 3, 0, KC_D);
+    auto       key_e    = KeymapKey(0, 4, 0, KC_E);
+
+    set_keymap({hold_key, key_b, key_c, key_d, key_e});
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+
+    /* More keys than slots go through the table and leave it free. */
+    for (auto key : {key_b, key_c, key_d, key_e}) {
+        tap_key(key);
+    }
+    const profiling_probe_t *tapping = latency_trace_get_probe(LATENCY_STAGE_TAPPING);
+    EXPECT_EQ(tapping->count, 8);
+    EXPECT_EQ(tapping->max, 0);
+
+    /* Half a wrap of the microsecond clock later, those free slots look newer than anything in flight. */
+    advance_time(UINT32_MAX / 2 / 1000 + 1000);
+
+    hold_key.press();
+    run_one_scan_loop();
+    for (auto key : {key_b, key_c, key_d}) {
+        key.press();
+        run_one_scan_loop();
+    }
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Only the tap-hold waited out the whole tapping term, the keys behind it were detected later. */
+    EXPECT_EQ(tapping->count, 8 + 4);
+    EXPECT_EQ(tapping->max, TAPPING_TERM * 1000);
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+    for (auto key : {hold_key, key_b, key_c, key_d}) {
+        key.release();
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+}
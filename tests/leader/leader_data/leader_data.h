@@ -0,0 +1,63 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+#include "quantum.h"
+
+// Leader sequence dictionary (5 entries):
+//   KC_A           -> KC_1
+//   KC_A KC_B      -> KC_2
+//   KC_C           -> LSFT(KC_C)
+//   KC_D KC_D      -> "dd"
+//   KC_D KC_E KC_F -> KC_3
+
+#define LEADER_DATA_SIZE 27
+
+static const uint16_t leader_data[LEADER_DATA_SIZE] PROGMEM = {
+    0x0003, KC_A, 0x0007, KC_C, 0x000D, KC_D, 0x000F, 0x8001, 0x0000, KC_B, 0x000B, 0x8000, 0x0001,
+    0x8000, 0x0002, 0x0002, KC_D, 0x0014, KC_E, 0x0016, 0x8000, 0x0003, 0x0001, KC_F, 0x0019,
+    0x8000, 0x0004
+};
+
+static void leader_data_action(uint16_t action) {
+    switch (action) {
+        case 0:
+            tap_code16(KC_1);
+            break;
+        case 1:
+            tap_code16(KC_2);
+            break;
+        case 2:
+            tap_code16(LSFT(KC_C));
+            break;
+        case 3:
+            SEND_STRING("dd");
+            break;
+        case 4:
+            tap_code16(KC_3);
+            break;
+    }
+}
@@ -0,0 +1,147 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LeaderData : public TestFixture {};
+
+TEST_F(LeaderData, unambiguous_sequence_fires_without_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_c      = KeymapKey(0, 1, 0, KC_C);
+
+    set_keymap({key_leader, key_c});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_C));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    tap_key(key_c);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderData, prefix_sequence_waits_for_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_leader, key_a});
+
+    tap_key(key_leader);
+
+    /* "a b" could still follow */
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_a);
+    EXPECT_EQ(leader_sequence_active(), true);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderData, longer_sequence_fires_on_last_key) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_b      = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({key_leader, key_a, key_b});
+
+    tap_key(key_leader);
+    tap_key(key_a);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Nothing else fires once the timeout passes */
+    EXPECT_NO_REPORT(driver);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderData, string_action_is_sent) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+
+    set_keymap({key_leader, key_d});
+
+    tap_key(key_leader);
+    tap_key(key_d);
+
+    EXPECT_REPORT(driver, (KC_D)).Times(2);
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderData, three_key_sequence) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+    auto key_e      = KeymapKey(0, 2, 0, KC_E);
+    auto key_f      = KeymapKey(0, 3, 0, KC_F);
+
+    set_keymap({key_leader, key_d, key_e, key_f});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_d);
+    tap_key(key_e);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_f);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderData, unknown_sequence_does_nothing) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_b      = KeymapKey(0, 1, 0, KC_B);
+    auto key_d      = KeymapKey(0, 2, 0, KC_D);
+    auto key_e      = KeymapKey(0, 3, 0, KC_E);
+
+    set_keymap({key_leader, key_b, key_d, key_e});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_b);
+    idle_for(300);
+    EXPECT_EQ(leader_sequence_active(), false);
+
+    /* An incomplete sequence does not fire either */
+    tap_key(key_leader);
+    tap_key(key_d);
+    tap_key(key_e);
+    idle_for(300);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
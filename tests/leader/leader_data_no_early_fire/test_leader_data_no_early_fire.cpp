@@ -0,0 +1,68 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" void leader_end_user(void) {
+    /* Longer than the dictionary's "c" */
+    if (leader_sequence_two_keys(KC_C, KC_X)) {
+        tap_code(KC_9);
+    }
+}
+
+class LeaderDataNoEarlyFire : public TestFixture {};
+
+TEST_F(LeaderDataNoEarlyFire, unambiguous_sequence_waits_for_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_c      = KeymapKey(0, 1, 0, KC_C);
+
+    set_keymap({key_leader, key_c});
+
+    tap_key(key_leader);
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_c);
+    EXPECT_EQ(leader_sequence_active(), true);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_C));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(300);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderDataNoEarlyFire, user_sequence_extends_dictionary_sequence) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_c      = KeymapKey(0, 1, 0, KC_C);
+    auto key_x      = KeymapKey(0, 2, 0, KC_X);
+
+    set_keymap({key_leader, key_c, key_x});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_c);
+    tap_key(key_x);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_9));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
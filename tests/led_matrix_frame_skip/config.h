@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define LED_MATRIX_FRAME_SKIP
+#define LED_MATRIX_LED_COUNT 4
+#define LED_MATRIX_DEFAULT_MODE LED_MATRIX_SOLID
+#define ENABLE_LED_MATRIX_ALPHAS_MODS
@@ -0,0 +1,55 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "led_matrix.h"
+#include "led_matrix_mock.h"
+
+// Driver counting the values written and the buffers flushed
+uint32_t led_matrix_mock_writes          = 0;
+uint32_t led_matrix_mock_flushes         = 0;
+bool     led_matrix_mock_indicator       = false;
+uint32_t led_matrix_mock_indicator_calls = 0;
+
+static void mock_init(void) {}
+
+static void mock_set_value(int index, uint8_t value) {
+    led_matrix_mock_writes++;
+}
+
+static void mock_set_value_all(uint8_t value) {
+    led_matrix_mock_writes++;
+}
+
+static void mock_flush(void) {
+    led_matrix_mock_flushes++;
+}
+
+const led_matrix_driver_t led_matrix_driver = {
+    .init          = mock_init,
+    .set_value     = mock_set_value,
+    .set_value_all = mock_set_value_all,
+    .flush         = mock_flush,
+};
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        { 0,      1,      NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { 2,      3,      NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+    }, {
+        { 0, 0 }, { 224, 0 }, { 0, 64 }, { 224, 64 },
+    }, {
+        4, 4, 4, 4,
+    }
+};
+// clang-format on
+
+bool led_matrix_indicators_user(void) {
+    led_matrix_mock_indicator_calls++;
+    if (led_matrix_mock_indicator) {
+        led_matrix_set_value(0, 0);
+    }
+    return true;
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint32_t led_matrix_mock_writes;
+extern uint32_t led_matrix_mock_flushes;
+extern bool     led_matrix_mock_indicator;
+extern uint32_t led_matrix_mock_indicator_calls;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "led_matrix.h"
+#include "led_matrix_mock.h"
+}
+
+using testing::_;
+
+class LedMatrixFrameSkip : public TestFixture {
+   protected:
+    /* Shows a solid value, and runs long enough for it to be drawn and flushed. Needs a TestDriver. */
+    void settle(void) {
+        led_matrix_mock_indicator = false;
+        led_matrix_enable_noeeprom();
+        led_matrix_mode_noeeprom(LED_MATRIX_SOLID);
+        led_matrix_set_val_noeeprom(255);
+        idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 3);
+        led_matrix_mock_writes          = 0;
+        led_matrix_mock_flushes         = 0;
+        led_matrix_mock_indicator_calls = 0;
+    }
+};
+
+TEST_F(LedMatrixFrameSkip, StaticEffectIsNeitherRenderedNorFlushed) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(led_matrix_mock_writes, 0);
+    EXPECT_EQ(led_matrix_mock_flushes, 0);
+    /* Skipped frames still check the indicators, once per frame */
+    EXPECT_NEAR(led_matrix_mock_indicator_calls, 10, 1);
+}
+
+TEST_F(LedMatrixFrameSkip, ConfigChangeRedrawsOnce) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    led_matrix_set_val_noeeprom(128);
+    idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(led_matrix_mock_writes, 0);
+    EXPECT_EQ(led_matrix_mock_flushes, 1);
+}
+
+TEST_F(LedMatrixFrameSkip, IndicatorChangeRedrawsOnce) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    led_matrix_mock_indicator = true;
+    idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 10);
+    EXPECT_EQ(led_matrix_mock_flushes, 1);
+    /* The frame which found the change ran them twice, as documented */
+    EXPECT_NEAR(led_matrix_mock_indicator_calls, 11, 1);
+
+    led_matrix_mock_indicator = false;
+    idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 10);
+    EXPECT_EQ(led_matrix_mock_flushes, 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LedMatrixFrameSkip, UnchangedFrameOfOtherEffectIsNotFlushed) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    led_matrix_mode_noeeprom(LED_MATRIX_ALPHAS_MODS);
+    idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    /* No key is a modifier, so every LED keeps the solid value: rendered every interval, as
+     * the effect is not known to be static, but never flushed. */
+    EXPECT_GE(led_matrix_mock_writes, LED_MATRIX_LED_COUNT * 9);
+    EXPECT_EQ(led_matrix_mock_flushes, 0);
+}
+
+TEST_F(LedMatrixFrameSkip, WriteOutsideFrameForcesFlush) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    led_matrix_set_value(1, 0);
+    idle_for(LED_MATRIX_LED_FLUSH_LIMIT * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(led_matrix_mock_flushes, 1);
+}
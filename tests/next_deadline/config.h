@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+#define ONESHOT_TIMEOUT 500
+#define COMBO_TERM 40
+#define LEADER_TIMEOUT 300
+#define CAPS_WORD_IDLE_TIMEOUT 2000
+#define AUTO_SHIFT_TIMEOUT 150
@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+uint16_t const f1_f2_combo[] = {KC_F1, KC_F2, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(f1_f2_combo, KC_F3),
+};
+
+tap_dance_action_t tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_F4, KC_F5),
+};
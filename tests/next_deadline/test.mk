@@ -0,0 +1,11 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+AUTO_SHIFT_ENABLE = yes
+CAPS_WORD_ENABLE = yes
+COMBO_ENABLE = yes
+DEFERRED_EXEC_ENABLE = yes
+LEADER_ENABLE = yes
+TAP_DANCE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = next_deadline_defs.c
@@ -0,0 +1,274 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+class NextDeadline : public TestFixture {
+   protected:
+    /* Reports are covered by the feature specific tests, these only check the timing. */
+    void allow_any_report(TestDriver& driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    }
+
+    void expect_deadline(uint32_t expected) {
+        uint32_t deadline = 0;
+        EXPECT_TRUE(keyboard_next_deadline(&deadline));
+        EXPECT_EQ(deadline, expected);
+    }
+
+    void expect_no_deadline(void) {
+        uint32_t deadline = 0;
+        EXPECT_FALSE(keyboard_next_deadline(&deadline)) << "unexpected deadline at " << deadline << ", now " << timer_read32();
+    }
+};
+
+static uint32_t deferred_callback(uint32_t trigger_time, void* cb_arg) {
+    return 0;
+}
+
+TEST_F(NextDeadline, IdleKeyboardHasNoDeadline) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_F6);
+
+    set_keymap({key});
+    expect_no_deadline();
+
+    EXPECT_REPORT(driver, (KC_F6));
+    key.press();
+    run_one_scan_loop();
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, HeldTapHoldKeyResolvesAtTappingTerm) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, LSFT_T(KC_F6));
+
+    set_keymap({key});
+    allow_any_report(driver);
+
+    uint32_t pressed_at = timer_read32();
+    key.press();
+    run_one_scan_loop();
+    expect_deadline(pressed_at + TAPPING_TERM);
+
+    idle_for(TAPPING_TERM - 1);
+    expect_deadline(pressed_at + TAPPING_TERM);
+
+    /* The tick event at the deadline settles the key as held */
+    run_one_scan_loop();
+    expect_no_deadline();
+
+    key.release();
+    run_one_scan_loop();
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, TappedKeyWaitsForQuickTapWindow) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, LSFT_T(KC_F6));
+
+    set_keymap({key});
+    allow_any_report(driver);
+
+    tap_key(key);
+    uint32_t released_at = timer_read32() - 1;
+    expect_deadline(released_at + TAPPING_TERM);
+
+    /* Held again as a tap: past the tapping term only the release changes state */
+    key.press();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM);
+    expect_no_deadline();
+
+    key.release();
+    run_one_scan_loop();
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, OneshotModsTimeout) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, OSM(MOD_LSFT));
+
+    set_keymap({key});
+    allow_any_report(driver);
+
+    tap_key(key);
+    uint32_t released_at = timer_read32() - 1;
+    idle_for(TAPPING_TERM);
+
+    uint32_t deadline = 0;
+    EXPECT_TRUE(oneshot_next_deadline(&deadline));
+    expect_deadline(deadline);
+    EXPECT_EQ(get_oneshot_mods(), MOD_BIT(KC_LSFT));
+    EXPECT_EQ(deadline, released_at + ONESHOT_TIMEOUT);
+
+    idle_for(deadline - timer_read32() + 1);
+    EXPECT_EQ(get_oneshot_mods(), 0);
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, ComboTermRuns) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_F1);
+
+    set_keymap({key, KeymapKey(0, 1, 0, KC_F2)});
+    allow_any_report(driver);
+    /* A combo timer started at time 0 counts as not running */
+    idle_for(1);
+
+    uint32_t pressed_at = timer_read32();
+    key.press();
+    run_one_scan_loop();
+    expect_deadline(pressed_at + COMBO_TERM + 1);
+
+    idle_for(COMBO_TERM + 1);
+    expect_no_deadline();
+
+    key.release();
+    run_one_scan_loop();
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, TapDanceWaitsForTappingTerm) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, TD(0));
+
+    set_keymap({key});
+    allow_any_report(driver);
+
+    uint32_t pressed_at = timer_read32();
+    tap_key(key);
+
+    uint32_t deadline = 0;
+    EXPECT_TRUE(tap_dance_next_deadline(&deadline));
+    EXPECT_EQ(deadline, pressed_at + TAPPING_TERM + 1);
+    expect_deadline(deadline);
+
+    idle_for(TAPPING_TERM + 1);
+    EXPECT_FALSE(tap_dance_next_deadline(&deadline));
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, LeaderSequenceTimeout) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, QK_LEADER);
+
+    set_keymap({key});
+    allow_any_report(driver);
+
+    uint32_t pressed_at = timer_read32();
+    tap_key(key);
+    EXPECT_TRUE(leader_sequence_active());
+    expect_deadline(pressed_at + LEADER_TIMEOUT + 1);
+
+    idle_for(LEADER_TIMEOUT + 1);
+    EXPECT_FALSE(leader_sequence_active());
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, CapsWordIdleTimeout) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, CW_TOGG);
+
+    set_keymap({key});
+    allow_any_report(driver);
+
+    tap_key(key);
+    EXPECT_TRUE(is_caps_word_on());
+
+    uint32_t deadline = 0;
+    EXPECT_TRUE(caps_word_next_deadline(&deadline));
+    expect_deadline(deadline);
+    EXPECT_GT(deadline, timer_read32());
+    EXPECT_LE(deadline, timer_read32() + CAPS_WORD_IDLE_TIMEOUT);
+
+    idle_for(deadline - timer_read32() + 1);
+    EXPECT_FALSE(is_caps_word_on());
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, AutoShiftTimeout) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    allow_any_report(driver);
+
+    uint32_t pressed_at = timer_read32();
+    key.press();
+    run_one_scan_loop();
+    expect_deadline(pressed_at + AUTO_SHIFT_TIMEOUT);
+
+    idle_for(AUTO_SHIFT_TIMEOUT);
+    expect_no_deadline();
+
+    key.release();
+    run_one_scan_loop();
+    expect_no_deadline();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, EarliestDeadlineWins) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_F1);
+
+    set_keymap({key, KeymapKey(0, 1, 0, KC_F2)});
+    allow_any_report(driver);
+    /* A combo timer started at time 0 counts as not running */
+    idle_for(1);
+
+    uint32_t       now   = timer_read32();
+    deferred_token token = defer_exec(COMBO_TERM * 4, deferred_callback, NULL);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    expect_deadline(now + COMBO_TERM * 4);
+
+    key.press();
+    run_one_scan_loop();
+    expect_deadline(now + COMBO_TERM + 1);
+
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    expect_deadline(now + COMBO_TERM + 1);
+
+    idle_for(COMBO_TERM + 1);
+    expect_no_deadline();
+
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(NextDeadline, OverdueDeadlineIsInThePast) {
+    TestDriver driver;
+
+    uint32_t       now   = timer_read32();
+    deferred_token token = defer_exec(5, deferred_callback, NULL);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+
+    /* The deferred executor task is not run by the test fixture */
+    advance_time(20);
+    expect_deadline(now + 5);
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    expect_no_deadline();
+}
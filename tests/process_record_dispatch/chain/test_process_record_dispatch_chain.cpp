@@ -0,0 +1,5 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Calling every handler must behave exactly like the range dispatch, so run the same tests against it.
+#include "../test_process_record_dispatch.cpp"
@@ -0,0 +1,18 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+const key_override_t ctrl_backspace_override = ko_make_basic(MOD_MASK_CTRL, KC_BSPC, KC_DEL);
+
+const key_override_t *key_overrides[] = {
+    &ctrl_backspace_override,
+};
+
+tap_dance_action_t tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_F4, KC_F5),
+};
+
+const uint32_t unicode_map[] = {
+    0x00E9,
+};
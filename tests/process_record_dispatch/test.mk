@@ -0,0 +1,24 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# A deliberately full-featured configuration, so that the benchmark covers a
+# long handler list.
+AUTOCORRECT_ENABLE = yes
+CAPS_WORD_ENABLE = yes
+DYNAMIC_MACRO_ENABLE = yes
+DYNAMIC_TAPPING_TERM_ENABLE = yes
+GRAVE_ESC_ENABLE = yes
+KEY_LOCK_ENABLE = yes
+KEY_OVERRIDE_ENABLE = yes
+LAYER_LOCK_ENABLE = yes
+LEADER_ENABLE = yes
+MAGIC_ENABLE = yes
+PROGRAMMABLE_BUTTON_ENABLE = yes
+REPEAT_KEY_ENABLE = yes
+SECURE_ENABLE = yes
+SPACE_CADET_ENABLE = yes
+TAP_DANCE_ENABLE = yes
+TRI_LAYER_ENABLE = yes
+UNICODEMAP_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = process_record_dispatch_defs.c
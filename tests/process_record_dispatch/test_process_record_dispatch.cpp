@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+class ProcessRecordDispatch : public TestFixture {};
+
+TEST_F(ProcessRecordDispatch, RangedHandlerSeesItsKeycodes) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, RangedHandlerSeesLayerKeycodes) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER);
+
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+
+    key.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, ObserversSeeBasicKeycodes) {
+    TestDriver driver;
+    auto       ctrl      = KeymapKey(0, 0, 0, KC_LCTL);
+    auto       backspace = KeymapKey(0, 1, 0, KC_BSPC);
+
+    set_keymap({ctrl, backspace});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    ctrl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The key override turns Ctrl+Backspace into Delete */
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_DEL)).Times(1);
+    backspace.press();
+    run_one_scan_loop();
+    backspace.release();
+    run_one_scan_loop();
+    ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, Benchmark) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    /* Typing prose is the common case, every keycode here is handled by the action layer */
+    static const uint16_t text[] = {KC_H, KC_E, KC_L, KC_L, KC_O, KC_SPC, KC_W, KC_O, KC_R, KC_L, KC_D, KC_DOT, KC_SPC};
+    const size_t          count  = sizeof(text) / sizeof(text[0]);
+
+    /* Report the best of several rounds, the host is noisy */
+    const int rounds     = 5;
+    const int iterations = 10000;
+    long long best       = -1;
+    for (int round = 0; round < rounds; round++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            for (size_t k = 0; k < count; k++) {
+                for (int pressed = 1; pressed >= 0; pressed--) {
+                    keyrecord_t record   = {};
+                    record.event.key.row = 0;
+                    record.event.key.col = k;
+                    record.event.pressed = pressed;
+                    record.event.type    = KEY_EVENT;
+                    record.event.time    = timer_read();
+                    record.keycode       = text[k];
+                    process_record_quantum(&record);
+                }
+            }
+        }
+        long long elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        if (best < 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+#ifdef PROCESS_RECORD_DISPATCH_ALL
+    const char *dispatch = "chain";
+#else
+    const char *dispatch = "ranged";
+#endif
+    printf("process_record_quantum %-6s: %lld ns/event\n", dispatch, best / (long long)(iterations * count * 2));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,155 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiling.h"
+#include "task_scheduler.h"
+
+void     advance_time(uint32_t ms);
+void     advance_time_us(uint32_t us);
+uint32_t timer_read_us(void);
+}
+
+static profiling_probe_t fast_probe = PROFILING_PROBE("fast");
+static profiling_probe_t slow_probe = PROFILING_PROBE("slow");
+
+static void sample(profiling_probe_t& probe, uint32_t us) {
+    PROFILE_BLOCK(probe, { advance_time_us(us); });
+}
+
+class Profiling : public TestFixture {
+   protected:
+    Profiling() {
+        profiling_clear();
+    }
+};
+
+TEST_F(Profiling, TestPlatformHasMicrosecondTimestamps) {
+    uint32_t start = profiling_timestamp();
+    advance_time_us(250);
+    EXPECT_EQ(profiling_elapsed(start), 250);
+
+    advance_time_us(900);
+    EXPECT_EQ(profiling_elapsed(start), 1150);
+    EXPECT_EQ(timer_read32(), 1);
+
+    advance_time(2);
+    EXPECT_EQ(profiling_elapsed(start), 3150);
+    EXPECT_EQ(timer_read_us(), 3150);
+}
+
+TEST_F(Profiling, RecordsMinMaxMean) {
+    sample(fast_probe, 10);
+    sample(fast_probe, 30);
+    sample(fast_probe, 20);
+
+    EXPECT_EQ(fast_probe.count, 3);
+    EXPECT_EQ(fast_probe.min, 10);
+    EXPECT_EQ(fast_probe.max, 30);
+    EXPECT_EQ(profiling_mean(&fast_probe), 20);
+    EXPECT_EQ(fast_probe.buckets[4], 1); // 8-15us
+    EXPECT_EQ(fast_probe.buckets[5], 2); // 16-31us
+    EXPECT_EQ(profiling_find("fast"), &fast_probe);
+}
+
+TEST_F(Profiling, PercentilesExposeTheTail) {
+    for (int i = 0; i < 98; i++) {
+        sample(fast_probe, 10);
+    }
+    sample(fast_probe, 5000);
+    sample(fast_probe, 6000);
+
+    /* The mean hides the spikes, the 99th percentile does not */
+    EXPECT_EQ(profiling_mean(&fast_probe), 119);
+    EXPECT_EQ(profiling_percentile(&fast_probe, 0), 10);
+    EXPECT_EQ(profiling_percentile(&fast_probe, 50), 15);
+    EXPECT_EQ(profiling_percentile(&fast_probe, 98), 15);
+    EXPECT_EQ(profiling_percentile(&fast_probe, 99), 6000);
+    EXPECT_EQ(profiling_percentile(&fast_probe, 100), 6000);
+}
+
+TEST_F(Profiling, PercentileOfEmptyProbeIsZero) {
+    EXPECT_EQ(profiling_percentile(&slow_probe, 99), 0);
+    EXPECT_EQ(profiling_mean(&slow_probe), 0);
+}
+
+TEST_F(Profiling, SlowestSamplesAreRetained) {
+    for (uint32_t i = 1; i <= PROFILING_SLOW_SAMPLES * 2; i++) {
+        sample(fast_probe, i * 10);
+    }
+    advance_time(5);
+    uint32_t spike_time = timer_read32();
+    sample(slow_probe, 2000);
+    sample(fast_probe, 1);
+
+    const profiling_sample_t* slowest = profiling_slowest(0);
+    ASSERT_NE(slowest, nullptr);
+    EXPECT_EQ(slowest->probe, &slow_probe);
+    EXPECT_EQ(slowest->duration, 2000);
+    EXPECT_EQ(slowest->time, spike_time + 2);
+
+    for (uint8_t i = 1; i < PROFILING_SLOW_SAMPLES; i++) {
+        slowest = profiling_slowest(i);
+        ASSERT_NE(slowest, nullptr);
+        EXPECT_EQ(slowest->probe, &fast_probe);
+        EXPECT_EQ(slowest->duration, (PROFILING_SLOW_SAMPLES * 2 + 1 - i) * 10);
+    }
+    EXPECT_EQ(profiling_slowest(PROFILING_SLOW_SAMPLES), nullptr);
+
+    profiling_clear();
+    EXPECT_EQ(profiling_slowest(0), nullptr);
+    EXPECT_EQ(fast_probe.count, 0);
+    EXPECT_EQ(profiling_find("slow"), &slow_probe);
+}
+
+TEST_F(Profiling, RawHidFill) {
+    sample(fast_probe, 0);
+    sample(fast_probe, 3);
+    sample(slow_probe, 100);
+
+    uint8_t index = 0;
+    for (profiling_probe_t* probe = profiling_probes(); probe != &slow_probe; probe = probe->next) {
+        ASSERT_NE(probe, nullptr);
+        ++index;
+    }
+
+    uint8_t data[32] = {0xAA, index, 0xFF};
+    ASSERT_TRUE(profiling_raw_hid_fill(data, sizeof(data)));
+    EXPECT_EQ(data[0], 0xAA);
+    EXPECT_STREQ((const char*)&data[3], "slow");
+
+    uint8_t stats[32] = {0xAA, index, 7};
+    ASSERT_TRUE(profiling_raw_hid_fill(stats, sizeof(stats)));
+    EXPECT_EQ(stats[3], PROFILING_HISTOGRAM_BUCKETS);
+    EXPECT_EQ(stats[4], 1);    // count
+    EXPECT_EQ(stats[8], 100);  // min
+    EXPECT_EQ(stats[12], 100); // max
+    EXPECT_EQ(stats[16], 100); // mean
+    EXPECT_EQ(stats[20], 100); // p99
+    EXPECT_EQ(stats[24], 1);   // bucket 7, 64-127us
+    EXPECT_EQ(stats[26], 0);
+
+    uint8_t missing[32] = {0xAA, 0xFE, 0};
+    EXPECT_FALSE(profiling_raw_hid_fill(missing, sizeof(missing)));
+}
+
+static void busy_task(void) {
+    advance_time(3);
+}
+
+TEST_F(Profiling, ScheduledTasksAreProfiled) {
+    TestDriver       driver;
+    scheduled_task_t busy = {.name = "busy", .task = busy_task, .priority = TASK_PRIORITY_DEFAULT};
+
+    ASSERT_TRUE(task_scheduler_register(&busy));
+    task_scheduler_run();
+    task_scheduler_run();
+    EXPECT_TRUE(task_scheduler_unregister(&busy));
+
+    EXPECT_EQ(profiling_find("busy"), &busy.profile);
+    EXPECT_EQ(busy.profile.count, 2);
+    EXPECT_EQ(busy.profile.max, 3000);
+}
@@ -0,0 +1,136 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ResolvedLayerCache : public TestFixture {
+   protected:
+    /* The cache inspects every layer of a key, so give every layer of the used positions a mapping. */
+    void fill_transparent(std::initializer_list<KeymapKey> keys) {
+        set_keymap(keys);
+        for (const auto& key : keys) {
+            for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+                if (!find_key(layer, key.position)) {
+                    add_key(KeymapKey(layer, key.position.col, key.position.row, KC_TRNS));
+                }
+            }
+        }
+    }
+
+    void replace_keycode(uint8_t layer, keypos_t position, uint16_t code) {
+        /* Bypasses add_key() on purpose, so the cache is not invalidated. */
+        std::vector<KeymapKey> rebuilt;
+        for (const auto& key : keymap) {
+            if (key.layer != layer || !KEYEQ(key.position, position)) {
+                rebuilt.push_back(key);
+            }
+        }
+        rebuilt.push_back(KeymapKey(layer, position.col, position.row, code));
+        keymap.swap(rebuilt);
+    }
+};
+
+TEST_F(ResolvedLayerCache, TransparentKeysFallThrough) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    fill_transparent({key, KeymapKey(2, 0, 0, KC_B), KeymapKey(3, 0, 0, KC_C)});
+
+    layer_clear();
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 2);
+    layer_on(3);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 3);
+    layer_off(3);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 2);
+    layer_clear();
+
+    default_layer_set((layer_state_t)1 << 3);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 3);
+    default_layer_set(1);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ResolvedLayerCache, MomentaryLayerResolvesThroughCache) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_key   = KeymapKey(0, 0, 0, MO(1));
+    auto       regular_key = KeymapKey(0, 1, 0, KC_A);
+
+    fill_transparent({layer_key, regular_key, KeymapKey(1, 1, 0, KC_B)});
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ResolvedLayerCache, LookupsDoNotTouchKeymapOnceCached) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    fill_transparent({key, KeymapKey(1, 0, 0, KC_B)});
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 1);
+
+    /* Change the keymap behind the cache's back: the stale result proves the keymap was not consulted. */
+    replace_keycode(1, key.position, KC_TRNS);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 1);
+
+    resolved_layer_cache_invalidate();
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ResolvedLayerCache, SingleKeyUpdate) {
+    TestDriver driver;
+    auto       key   = KeymapKey(0, 0, 0, KC_A);
+    auto       other = KeymapKey(0, 1, 0, KC_B);
+
+    fill_transparent({key, other});
+
+    layer_on(4);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(other.position), 0);
+
+    /* Only the invalidated key is read from the keymap again. */
+    replace_keycode(4, key.position, KC_D);
+    replace_keycode(4, other.position, KC_E);
+    resolved_layer_cache_invalidate_key(key.position);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 4);
+    EXPECT_EQ(layer_switch_get_layer(other.position), 0);
+
+    replace_keycode(4, key.position, KC_TRNS);
+    resolved_layer_cache_invalidate_key(key.position);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
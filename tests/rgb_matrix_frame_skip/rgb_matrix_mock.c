@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include "rgb_matrix_mock.h"
+
+// Driver counting the colors written and the buffers flushed
+uint32_t rgb_matrix_mock_writes    = 0;
+uint32_t rgb_matrix_mock_flushes   = 0;
+bool     rgb_matrix_mock_indicator = false;
+
+static void mock_init(void) {}
+
+static void mock_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    rgb_matrix_mock_writes++;
+}
+
+static void mock_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    rgb_matrix_mock_writes++;
+}
+
+static void mock_flush(void) {
+    rgb_matrix_mock_flushes++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = mock_init,
+    .set_color     = mock_set_color,
+    .set_color_all = mock_set_color_all,
+    .flush         = mock_flush,
+};
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        { 0,      1,      NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { 2,      3,      NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+    }, {
+        { 0, 0 }, { 224, 0 }, { 0, 64 }, { 224, 64 },
+    }, {
+        4, 4, 4, 4,
+    }
+};
+// clang-format on
+
+bool rgb_matrix_indicators_user(void) {
+    if (rgb_matrix_mock_indicator) {
+        rgb_matrix_set_color(0, 0, 0, 0);
+    }
+    return true;
+}
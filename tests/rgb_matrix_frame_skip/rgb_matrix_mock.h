@@ -0,0 +1,19 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint32_t rgb_matrix_mock_writes;
+extern uint32_t rgb_matrix_mock_flushes;
+extern bool     rgb_matrix_mock_indicator;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,93 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_mock.h"
+}
+
+using testing::_;
+
+class RgbMatrixFrameSkip : public TestFixture {
+   protected:
+    /* Shows a solid color, and runs long enough for it to be drawn and flushed. Needs a TestDriver. */
+    void settle(void) {
+        rgb_matrix_mock_indicator = false;
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 3);
+        rgb_matrix_mock_writes  = 0;
+        rgb_matrix_mock_flushes = 0;
+    }
+};
+
+TEST_F(RgbMatrixFrameSkip, StaticEffectIsNeitherRenderedNorFlushed) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(rgb_matrix_mock_writes, 0);
+    EXPECT_EQ(rgb_matrix_mock_flushes, 0);
+}
+
+TEST_F(RgbMatrixFrameSkip, ConfigChangeRedrawsOnce) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    rgb_matrix_sethsv_noeeprom(85, 255, 255);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_GT(rgb_matrix_mock_writes, 0);
+    EXPECT_EQ(rgb_matrix_mock_flushes, 1);
+}
+
+TEST_F(RgbMatrixFrameSkip, IndicatorChangeRedrawsOnce) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    rgb_matrix_mock_indicator = true;
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 10);
+    EXPECT_EQ(rgb_matrix_mock_flushes, 1);
+
+    rgb_matrix_mock_indicator = false;
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 10);
+    EXPECT_EQ(rgb_matrix_mock_flushes, 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixFrameSkip, UnchangedFrameOfOtherEffectIsNotFlushed) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_ALPHAS_MODS);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    /* No key is a modifier, so every LED keeps the solid color: rendered every interval, as
+     * the effect is not known to be static, but never flushed. */
+    EXPECT_GE(rgb_matrix_mock_writes, RGB_MATRIX_LED_COUNT * 9);
+    EXPECT_EQ(rgb_matrix_mock_flushes, 0);
+}
+
+TEST_F(RgbMatrixFrameSkip, WriteOutsideFrameForcesFlush) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    rgb_matrix_set_color(1, 0, 0, 255);
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(rgb_matrix_mock_flushes, 1);
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_DISTANCE_TABLE
+#define ENABLE_RGB_MATRIX_CYCLE_SPIRAL
+#define RGB_MATRIX_LED_COUNT 4
+#define RGB_MATRIX_DEFAULT_MODE RGB_MATRIX_SOLID_COLOR
@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include "rgb_matrix_mock.h"
+
+static void mock_init(void) {}
+
+static void mock_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {}
+
+static void mock_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+
+static void mock_flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = mock_init,
+    .set_color     = mock_set_color,
+    .set_color_all = mock_set_color_all,
+    .flush         = mock_flush,
+};
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        { 0,      1,      NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { 2,      3,      NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+    }, {
+        { 0, 0 }, { 224, 0 }, { 0, 64 }, { 224, 64 },
+    }, {
+        4, 4, 4, 4,
+    }
+};
+// clang-format on
+
+led_polar_t        rgb_matrix_mock_polar[RGB_MATRIX_LED_COUNT];
+const led_polar_t *g_led_polar = rgb_matrix_mock_polar;
+
+// Ordered by the higher LED index then the lower, as generated from info.json
+uint8_t        rgb_matrix_mock_distance[RGB_MATRIX_LED_COUNT * (RGB_MATRIX_LED_COUNT - 1) / 2];
+const uint8_t *g_led_distance = rgb_matrix_mock_distance;
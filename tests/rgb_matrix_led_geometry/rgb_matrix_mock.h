@@ -0,0 +1,19 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "rgb_matrix_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Back g_led_polar and g_led_distance, so tests can make them match g_led_config or not
+extern led_polar_t rgb_matrix_mock_polar[RGB_MATRIX_LED_COUNT];
+extern uint8_t rgb_matrix_mock_distance[RGB_MATRIX_LED_COUNT * (RGB_MATRIX_LED_COUNT - 1) / 2];
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "rgb_matrix_mock.h"
+}
+
+/* atan2_8() and sqrt16() of the corners of the mock layout around the default center */
+static const led_polar_t expected_polar[] = {
+    {143, 116, 64},
+    {241, 116, 64},
+    {113, 116, 64},
+    {15, 116, 64},
+};
+
+/* sqrt16() of the distances between the corners of the mock layout, in table order */
+static const uint8_t expected_distance[] = {
+    224,           // 1-0
+    64,  232,      // 2-0, 2-1
+    232, 64,  224, // 3-0, 3-1, 3-2
+};
+
+class RgbMatrixLedGeometry : public TestFixture {
+   protected:
+    RgbMatrixLedGeometry() {
+        memcpy(rgb_matrix_mock_polar, expected_polar, sizeof(expected_polar));
+        memcpy(rgb_matrix_mock_distance, expected_distance, sizeof(expected_distance));
+    }
+};
+
+static void expect_polar(uint8_t index, const led_polar_t &expected) {
+    led_polar_t polar = rgb_matrix_led_polar(index);
+    EXPECT_EQ(polar.angle, expected.angle) << (int)index;
+    EXPECT_EQ(polar.dist, expected.dist) << (int)index;
+    EXPECT_EQ(polar.dual_dist, expected.dual_dist) << (int)index;
+}
+
+TEST_F(RgbMatrixLedGeometry, MatchingTableGivesComputedPolar) {
+    rgb_matrix_init();
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        expect_polar(i, expected_polar[i]);
+    }
+}
+
+TEST_F(RgbMatrixLedGeometry, PolarIsReadFromTheTable) {
+    rgb_matrix_init();
+
+    /* Changed after the check at init, so only a table lookup can return it */
+    rgb_matrix_mock_polar[1].angle = 99;
+    expect_polar(1, {99, 116, 64});
+    expect_polar(2, expected_polar[2]);
+}
+
+TEST_F(RgbMatrixLedGeometry, MismatchedPolarTableIsIgnored) {
+    rgb_matrix_mock_polar[3].dual_dist = 99;
+    rgb_matrix_init();
+
+    expect_polar(3, expected_polar[3]);
+
+    /* The whole table is dropped, not just the stale entry */
+    rgb_matrix_mock_polar[0].angle = 99;
+    expect_polar(0, expected_polar[0]);
+}
+
+TEST_F(RgbMatrixLedGeometry, MatchingTableGivesComputedDistances) {
+    rgb_matrix_init();
+
+    uint8_t entry = 0;
+    for (uint8_t hi = 1; hi < RGB_MATRIX_LED_COUNT; hi++) {
+        for (uint8_t lo = 0; lo < hi; lo++, entry++) {
+            EXPECT_EQ(rgb_matrix_led_distance(hi, lo), expected_distance[entry]) << (int)hi << "-" << (int)lo;
+            EXPECT_EQ(rgb_matrix_led_distance(lo, hi), expected_distance[entry]) << (int)lo << "-" << (int)hi;
+        }
+        EXPECT_EQ(rgb_matrix_led_distance(hi, hi), 0);
+    }
+}
+
+TEST_F(RgbMatrixLedGeometry, DistancesAreReadFromTheTable) {
+    rgb_matrix_init();
+
+    /* Changed after the check at init, so only a table lookup can return it */
+    rgb_matrix_mock_distance[2] = 99;
+    EXPECT_EQ(rgb_matrix_led_distance(2, 1), 99);
+    EXPECT_EQ(rgb_matrix_led_distance(1, 2), 99);
+    EXPECT_EQ(rgb_matrix_led_distance(3, 0), 232);
+}
+
+TEST_F(RgbMatrixLedGeometry, MismatchedTableIsIgnored) {
+    rgb_matrix_mock_distance[2] = 99;
+    rgb_matrix_init();
+
+    EXPECT_EQ(rgb_matrix_led_distance(2, 1), 232);
+    EXPECT_EQ(rgb_matrix_led_distance(3, 2), 224);
+
+    /* The whole table is dropped, not just the stale entry */
+    rgb_matrix_mock_distance[5] = 99;
+    EXPECT_EQ(rgb_matrix_led_distance(3, 2), 224);
+}
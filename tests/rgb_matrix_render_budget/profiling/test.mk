@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+PROFILING_ENABLE = yes
+
+SRC += ../rgb_matrix_mock.c ../test_rgb_matrix_render_budget.cpp
@@ -0,0 +1,67 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include "rgb_matrix_mock.h"
+
+void advance_time_us(uint32_t us);
+
+// Driver taking a configurable time per LED, and the slices of the last complete frame as seen by the indicators
+uint32_t rgb_matrix_mock_cost_us       = 10;
+uint8_t  rgb_matrix_mock_slices        = 0;
+uint8_t  rgb_matrix_mock_longest_slice = 0;
+
+static void mock_init(void) {}
+
+static void mock_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    advance_time_us(rgb_matrix_mock_cost_us);
+}
+
+static void mock_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    advance_time_us(rgb_matrix_mock_cost_us);
+}
+
+static void mock_flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = mock_init,
+    .set_color     = mock_set_color,
+    .set_color_all = mock_set_color_all,
+    .flush         = mock_flush,
+};
+
+// clang-format off
+led_config_t g_led_config = {
+    {
+        { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9  },
+        { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+        { NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED },
+    }, {
+        { 0, 0 }, { 24, 0 }, { 48, 0 }, { 72, 0 }, { 96, 0 }, { 120, 0 }, { 144, 0 }, { 168, 0 }, { 192, 0 }, { 216, 0 },
+        { 0, 64 }, { 24, 64 }, { 48, 64 }, { 72, 64 }, { 96, 64 }, { 120, 64 }, { 144, 64 }, { 168, 64 }, { 192, 64 }, { 216, 64 },
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    }
+};
+// clang-format on
+
+static uint8_t slices        = 0;
+static uint8_t longest_slice = 0;
+
+bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    if (led_min == 0) {
+        slices        = 0;
+        longest_slice = 0;
+    }
+    slices++;
+    if (led_max - led_min > longest_slice) {
+        longest_slice = led_max - led_min;
+    }
+    if (led_max == RGB_MATRIX_LED_COUNT) {
+        rgb_matrix_mock_slices        = slices;
+        rgb_matrix_mock_longest_slice = longest_slice;
+    }
+    return true;
+}
@@ -0,0 +1,18 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint32_t rgb_matrix_mock_cost_us;
+extern uint8_t  rgb_matrix_mock_slices;
+extern uint8_t  rgb_matrix_mock_longest_slice;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,96 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiling.h"
+#include "rgb_matrix.h"
+#include "rgb_matrix_mock.h"
+}
+
+using testing::_;
+
+class RgbMatrixRenderBudget : public TestFixture {
+   protected:
+    /* Runs enough frames for the measured cost to settle. Needs a TestDriver. */
+    void render_frames(uint32_t cost_us) {
+        rgb_matrix_mock_cost_us = cost_us;
+        idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 20);
+    }
+};
+
+TEST_F(RgbMatrixRenderBudget, SlicesFitTheBudget) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    render_frames(10);
+    VERIFY_AND_CLEAR(driver);
+
+    /* 50us at 10us per LED */
+    EXPECT_EQ(rgb_matrix_mock_longest_slice, 5);
+    EXPECT_EQ(rgb_matrix_mock_slices, RGB_MATRIX_LED_COUNT / 5);
+}
+
+TEST_F(RgbMatrixRenderBudget, SlicesFollowTheCost) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+
+    /* A cheap effect is drawn in a single slice... */
+    render_frames(1);
+    EXPECT_EQ(rgb_matrix_mock_longest_slice, RGB_MATRIX_LED_COUNT);
+    EXPECT_EQ(rgb_matrix_mock_slices, 1);
+
+    /* ...and an expensive one an LED at a time. */
+    render_frames(80);
+    EXPECT_EQ(rgb_matrix_mock_longest_slice, 1);
+    EXPECT_EQ(rgb_matrix_mock_slices, RGB_MATRIX_LED_COUNT);
+    VERIFY_AND_CLEAR(driver);
+}
+
+#ifdef PROFILING_ENABLE
+TEST_F(RgbMatrixRenderBudget, SlicesAreProfiled) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    profiling_clear();
+    render_frames(10);
+    VERIFY_AND_CLEAR(driver);
+
+    const profiling_probe_t *probe = profiling_find("rgb render");
+    ASSERT_NE(probe, nullptr);
+    EXPECT_GT(probe->count, 0);
+    EXPECT_LE(profiling_percentile(probe, 50), RGB_MATRIX_RENDER_BUDGET_US);
+}
+#endif
+
+TEST_F(RgbMatrixRenderBudget, StatsCountFramesAndSlices) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    render_frames(10);
+
+    /* Once settled, every frame has the same number of slices, all within the budget */
+    rgb_render_stats_t before = *rgb_matrix_get_render_stats();
+    render_frames(10);
+    rgb_render_stats_t after  = *rgb_matrix_get_render_stats();
+    uint32_t           frames = after.frames - before.frames;
+    EXPECT_GT(frames, 0);
+    EXPECT_NEAR(after.slices - before.slices, frames * rgb_matrix_mock_slices, rgb_matrix_mock_slices);
+    EXPECT_EQ(after.over_budget, before.over_budget);
+
+    /* Slices sized for the old cost overrun until the new one is measured */
+    render_frames(20);
+    EXPECT_GT(rgb_matrix_get_render_stats()->over_budget, after.over_budget);
+    VERIFY_AND_CLEAR(driver);
+}
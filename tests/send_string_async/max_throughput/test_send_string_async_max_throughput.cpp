@@ -0,0 +1,108 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+class SendStringAsyncMaxThroughput : public TestFixture {
+   protected:
+    SendStringAsyncMaxThroughput() {
+        send_string_async_cancel();
+    }
+};
+
+TEST_F(SendStringAsyncMaxThroughput, AscendingKeysSharePressReport) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async_with_delay("abcb", 0));
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+        EXPECT_EMPTY_REPORT(driver);
+        /* A repeated key needs its own press */
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(5);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsyncMaxThroughput, OrderIsPreserved) {
+    TestDriver driver;
+
+    /* 'h' comes after 'e' in usage order, so they can not share a report */
+    EXPECT_TRUE(send_string_async_with_delay("he", 0));
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_H));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_E));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsyncMaxThroughput, ModifiersSplitPacks) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async_with_delay("aBC", 0));
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_B, KC_C));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(7);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsyncMaxThroughput, OneReportPerFrame) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async_with_delay("a", 0));
+    EXPECT_REPORT(driver, (KC_A));
+    send_string_async_task();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The release waits for the next millisecond rather than the next loop */
+    uint32_t deadline = 0;
+    EXPECT_TRUE(send_string_async_next_deadline(&deadline));
+    EXPECT_EQ(deadline, timer_read32() + 1);
+
+    EXPECT_NO_REPORT(driver);
+    send_string_async_task();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    advance_time(1);
+    send_string_async_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsyncMaxThroughput, IntervalDisablesPacking) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async_with_delay("ab", 2));
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,180 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class SendStringAsync : public TestFixture {
+   protected:
+    SendStringAsync() {
+        send_string_async_cancel();
+    }
+};
+
+TEST_F(SendStringAsync, TypesOneReportPerLoop) {
+    TestDriver driver;
+
+    /* Nothing is typed until the main loop runs */
+    EXPECT_NO_REPORT(driver);
+    EXPECT_TRUE(send_string_async("ab"));
+    EXPECT_TRUE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(4);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, ShiftIsReleasedBetweenCharacters) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async("Hi"));
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_H));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_I));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(8);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, IntervalIsWaitedForWithoutBlocking) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_F1);
+
+    set_keymap({key});
+
+    EXPECT_TRUE(send_string_async_with_delay("a", 10));
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The matrix is still scanned while the string is being typed */
+    EXPECT_REPORT(driver, (KC_A, KC_F1));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F1));
+    idle_for(9);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, DelayIsNonBlocking) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async("a" SS_DELAY(50) "b"));
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(3);
+    VERIFY_AND_CLEAR(driver);
+
+    uint32_t deadline = 0;
+    EXPECT_TRUE(send_string_async_next_deadline(&deadline));
+    EXPECT_EQ(deadline, timer_read32() + 49);
+    EXPECT_TRUE(keyboard_next_deadline(&deadline));
+    EXPECT_EQ(deadline, timer_read32() + 49);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(49);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(3);
+    EXPECT_FALSE(send_string_async_next_deadline(&deadline));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, TapDownAndUpCodes) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async(SS_DOWN(X_LCTL) SS_TAP(X_C) SS_UP(X_LCTL)));
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LCTL));
+        EXPECT_REPORT(driver, (KC_LCTL, KC_C));
+        EXPECT_REPORT(driver, (KC_LCTL));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    idle_for(5);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, QueueIsBounded) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    /* Each string takes its length plus two bytes */
+    EXPECT_EQ(send_string_async_free(), 16);
+    EXPECT_TRUE(send_string_async("abcdef"));
+    EXPECT_EQ(send_string_async_free(), 8);
+    EXPECT_FALSE(send_string_async("abcdefg"));
+    EXPECT_EQ(send_string_async_free(), 8);
+    EXPECT_TRUE(send_string_async("abcdef"));
+    EXPECT_EQ(send_string_async_free(), 0);
+    EXPECT_FALSE(send_string_async(""));
+
+    idle_for(100);
+    EXPECT_FALSE(send_string_async_busy());
+    EXPECT_EQ(send_string_async_free(), 16);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, CancelReleasesHeldKeys) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async_with_delay("A", 10));
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    }
+    idle_for(11);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_string_async_cancel();
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,186 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <set>
+#include <string>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+using testing::Invoke;
+
+/* Decodes reports the way a host would: keys newly pressed in a report are
+ * handled in usage order, and turned back into characters with the US layout.
+ */
+class HostTyping {
+   public:
+    explicit HostTyping(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([this](report_keyboard_t &report) { receive(report); }));
+    }
+
+    std::string text;
+    int         reports = 0;
+
+   private:
+    std::set<uint8_t> held;
+
+    void receive(const report_keyboard_t &report) {
+        reports++;
+        std::set<uint8_t> now;
+        for (uint8_t key : report.keys) {
+            if (key != KC_NO) {
+                now.insert(key);
+            }
+        }
+        /* std::set iterates in usage order */
+        for (uint8_t key : now) {
+            if (!held.count(key)) {
+                type(key, report.mods);
+            }
+        }
+        held = now;
+    }
+
+    void type(uint8_t key, uint8_t mods) {
+        if (mods & MOD_MASK_CTRL) {
+            text += '^';
+        }
+        bool shifted = mods & MOD_MASK_SHIFT;
+        for (int ascii = 1; ascii < 128; ascii++) {
+            if (pgm_read_byte(&ascii_to_keycode_lut[ascii]) == key && (bool)((ascii_to_shift_lut[ascii / 8] >> (ascii % 8)) & 1) == shifted) {
+                text += (char)ascii;
+                return;
+            }
+        }
+        text += '?';
+    }
+};
+
+class SendStringBulk : public TestFixture {};
+
+TEST_F(SendStringBulk, TypesTheSameText) {
+    TestDriver driver;
+    HostTyping host(driver);
+
+    const char *text = "The quick brown fox jumps over the lazy dog, 1234 times!";
+    send_string_with_delay(text, 0);
+    EXPECT_EQ(host.text, text);
+    EXPECT_LT(host.reports, 2 * (int)strlen(text));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, AscendingKeysSharePressReport) {
+    TestDriver driver;
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+        EXPECT_EMPTY_REPORT(driver);
+        /* A repeated key needs its own press */
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+        /* 'a' comes before 'b' in usage order, so it can not join it */
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_string_with_delay("abcba", 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, ModifiersAreHeldAcrossReports) {
+    TestDriver driver;
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_H));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_A, KC_B));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_string_with_delay("aHAB", 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, ReportLimitIsRespected) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_Z);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_Z));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Only five slots of the 6KRO report are free */
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_Z, KC_A, KC_B, KC_C, KC_D, KC_E));
+        EXPECT_REPORT(driver, (KC_Z));
+        EXPECT_REPORT(driver, (KC_Z, KC_F));
+        EXPECT_REPORT(driver, (KC_Z));
+    }
+    send_string_with_delay("abcdef", 0);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, CommandsFlushPendingKeys) {
+    TestDriver driver;
+    HostTyping host(driver);
+
+    send_string_with_delay("ab" SS_TAP(X_X) "cd" SS_LSFT("ef") "\ng", 0);
+    EXPECT_EQ(host.text, "abxcdEF\ng");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, IntervalTypesOneKeyAtATime) {
+    TestDriver driver;
+    HostTyping host(driver);
+
+    send_string_with_delay("abc", 1);
+    EXPECT_EQ(host.text, "abc");
+    EXPECT_EQ(host.reports, 6);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, UnicodeDigitsAreBatched) {
+    TestDriver driver;
+    HostTyping host(driver);
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+    register_unicode(0x1F600);
+    EXPECT_EQ(host.text, "^U1f600 ");
+    /* The Ctrl+Shift+U prefix and the closing space take six reports. The digits are pressed as
+     * "1", "f60" and "0", so they take the other six. */
+    int batched = host.reports;
+    EXPECT_EQ(batched, 12);
+
+    /* Typed one at a time, as without bulk typing, the digits alone take ten */
+    host.reports = 0;
+    send_string_with_delay("1f600", 1);
+    EXPECT_EQ(host.reports, 10);
+    EXPECT_LT(batched, 6 + host.reports);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBulk, UnicodeStringRoundTrips) {
+    TestDriver driver;
+    HostTyping host(driver);
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+    send_unicode_string("\xC3\xBC\xE2\x82\xAC");
+    EXPECT_EQ(host.text, "^U00fc ^U20ac ");
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,162 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <thread>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "spsc_queue.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::InSequence;
+
+typedef struct {
+    uint32_t sequence;
+    uint32_t check;
+} test_item_t;
+
+SPSC_QUEUE_DECLARE(test_queue, test_item_t, 8);
+
+class SpscQueue : public TestFixture {};
+
+TEST_F(SpscQueue, PushPopInOrder) {
+    test_queue_t queue = {};
+    test_item_t  item;
+
+    EXPECT_FALSE(test_queue_pop(&queue, &item));
+    for (uint32_t i = 0; i < 8; i++) {
+        item = {i, ~i};
+        EXPECT_TRUE(test_queue_push(&queue, &item));
+    }
+    EXPECT_EQ(test_queue_count(&queue), 8);
+
+    /* Every slot is usable, and a full queue refuses more. */
+    item = {8, ~8u};
+    EXPECT_FALSE(test_queue_push(&queue, &item));
+
+    for (uint32_t i = 0; i < 8; i++) {
+        EXPECT_TRUE(test_queue_pop(&queue, &item));
+        EXPECT_EQ(item.sequence, i);
+    }
+    EXPECT_FALSE(test_queue_pop(&queue, &item));
+    EXPECT_EQ(test_queue_count(&queue), 0);
+}
+
+TEST_F(SpscQueue, IndicesWrapAround) {
+    test_queue_t queue = {};
+    test_item_t  item;
+    uint32_t     popped = 0;
+
+    /* Run the free running indices through several overflows with a partly filled queue. */
+    for (uint32_t i = 0; i < 1000; i++) {
+        item = {i, ~i};
+        ASSERT_TRUE(test_queue_push(&queue, &item));
+        if (test_queue_count(&queue) == 5) {
+            ASSERT_TRUE(test_queue_pop(&queue, &item));
+            EXPECT_EQ(item.sequence, popped++);
+        }
+    }
+    EXPECT_EQ(test_queue_count(&queue), 4);
+
+    test_queue_drain(&queue);
+    EXPECT_EQ(test_queue_count(&queue), 0);
+    EXPECT_FALSE(test_queue_pop(&queue, &item));
+}
+
+TEST_F(SpscQueue, ConcurrentProducerAndConsumer) {
+    static test_queue_t queue;
+    const uint32_t      total = 100000;
+    std::atomic<bool>   start{false};
+
+    queue = {};
+
+    /* The consumer must never see a slot before the producer finished writing it,
+     * and the producer must never overwrite a slot the consumer has not read yet. */
+    std::thread producer([&]() {
+        while (!start.load()) {
+            std::this_thread::yield();
+        }
+        for (uint32_t i = 0; i < total; i++) {
+            test_item_t item = {i, ~i};
+            while (!test_queue_push(&queue, &item)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 0;
+    uint32_t torn     = 0;
+    start.store(true);
+    while (expected < total) {
+        test_item_t item;
+        if (test_queue_pop(&queue, &item)) {
+            if (item.sequence != expected || item.check != ~expected) {
+                torn++;
+            }
+            expected++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(torn, 0);
+    EXPECT_EQ(test_queue_count(&queue), 0);
+}
+
+class KeyEventQueue : public TestFixture {};
+
+TEST_F(KeyEventQueue, QueuedEventsAreProcessed) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TRUE(key_event_queue_push(key.position.row, key.position.col, true));
+    EXPECT_TRUE(key_event_queue_push(key.position.row, key.position.col, false));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventQueue, FullQueueDropsEvents) {
+    TestDriver driver;
+
+    set_keymap({KeymapKey(0, 0, 0, KC_NO)});
+
+    EXPECT_NO_REPORT(driver);
+    for (uint8_t i = 0; i < KEY_EVENT_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(key_event_queue_push(0, 0, i % 2 == 0));
+    }
+    EXPECT_FALSE(key_event_queue_push(0, 0, true));
+    run_one_scan_loop();
+    EXPECT_TRUE(key_event_queue_push(0, 0, true));
+    EXPECT_TRUE(key_event_queue_push(0, 0, false));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventQueue, EventsKeepTheirCaptureTime) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, LSFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    /* Processed in the same scan, but captured further apart than the tapping term, so a hold. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TRUE(key_event_queue_push(mod_tap_key.position.row, mod_tap_key.position.col, true));
+    advance_time(TAPPING_TERM + 1);
+    EXPECT_TRUE(key_event_queue_push(mod_tap_key.position.row, mod_tap_key.position.col, false));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
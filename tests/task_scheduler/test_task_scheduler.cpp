@@ -0,0 +1,149 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_scheduler.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::InSequence;
+
+static std::vector<std::string> run_order;
+
+static void first_task(void) {
+    run_order.push_back("first");
+}
+
+static void second_task(void) {
+    run_order.push_back("second");
+}
+
+static void slow_task(void) {
+    run_order.push_back("slow");
+    advance_time(3);
+}
+
+class TaskScheduler : public TestFixture {
+   protected:
+    scheduled_task_t first  = {.name = "first", .task = first_task, .priority = TASK_PRIORITY_DEFAULT};
+    scheduled_task_t second = {.name = "second", .task = second_task, .priority = TASK_PRIORITY_MATRIX};
+    scheduled_task_t slow   = {.name = "slow", .task = slow_task, .budget = 1000, .priority = TASK_PRIORITY_DEFAULT};
+
+    TaskScheduler() {
+        run_order.clear();
+        task_scheduler_clear_stats();
+    }
+
+    ~TaskScheduler() {
+        task_scheduler_unregister(&first);
+        task_scheduler_unregister(&second);
+        task_scheduler_unregister(&slow);
+    }
+};
+
+TEST_F(TaskScheduler, MatrixScanRunsFirst) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    scheduled_task_t *task = task_scheduler_tasks();
+    ASSERT_NE(task, nullptr);
+    EXPECT_STREQ(task->name, "matrix_task");
+    EXPECT_EQ(task_scheduler_find("led_task")->period, TASK_SCHEDULER_SLOW_TASK_PERIOD);
+
+    /* Registered tasks of equal priority run after the matrix scan, however they are registered */
+    EXPECT_TRUE(task_scheduler_register(&first));
+    EXPECT_TRUE(task_scheduler_register(&second));
+    EXPECT_EQ(task_scheduler_tasks(), task);
+    EXPECT_EQ(task->next, &second);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(task->profile.count, 2);
+    EXPECT_EQ(run_order, (std::vector<std::string>{"second", "first", "second", "first"}));
+}
+
+TEST_F(TaskScheduler, UnsetPriorityRunsLast) {
+    TestDriver       driver;
+    scheduled_task_t unset = {.name = "unset", .task = first_task};
+
+    EXPECT_TRUE(task_scheduler_register(&unset));
+
+    scheduled_task_t *last = task_scheduler_tasks();
+    while (last->next) {
+        last = last->next;
+    }
+    EXPECT_EQ(last, &unset);
+    EXPECT_STREQ(task_scheduler_tasks()->name, "matrix_task");
+
+    EXPECT_TRUE(task_scheduler_unregister(&unset));
+}
+
+TEST_F(TaskScheduler, RegistrationIsChecked) {
+    TestDriver       driver;
+    scheduled_task_t empty = {.name = "empty"};
+
+    EXPECT_FALSE(task_scheduler_register(NULL));
+    EXPECT_FALSE(task_scheduler_register(&empty));
+    EXPECT_TRUE(task_scheduler_register(&first));
+    EXPECT_FALSE(task_scheduler_register(&first));
+    EXPECT_EQ(task_scheduler_find("first"), &first);
+
+    EXPECT_TRUE(task_scheduler_unregister(&first));
+    EXPECT_FALSE(task_scheduler_unregister(&first));
+    EXPECT_EQ(task_scheduler_find("first"), nullptr);
+
+    run_one_scan_loop();
+    EXPECT_TRUE(run_order.empty());
+}
+
+TEST_F(TaskScheduler, PeriodLimitsRunRate) {
+    TestDriver driver;
+
+    first.period = 10;
+    EXPECT_TRUE(task_scheduler_register(&first));
+
+    /* A newly registered task is due straight away */
+    idle_for(100);
+    EXPECT_EQ(first.profile.count, 10);
+    EXPECT_EQ(task_scheduler_find("matrix_task")->profile.count, 100);
+
+    first.period = 0;
+    idle_for(5);
+    EXPECT_EQ(first.profile.count, 15);
+}
+
+TEST_F(TaskScheduler, RecordsTimeAndOverruns) {
+    TestDriver driver;
+
+    EXPECT_TRUE(task_scheduler_register(&slow));
+
+    run_one_scan_loop();
+    run_one_scan_loop();
+    EXPECT_EQ(slow.profile.count, 2);
+    EXPECT_EQ(slow.profile.sum, 6000);
+    EXPECT_EQ(slow.profile.max, 3000);
+    EXPECT_EQ(slow.overruns, 2);
+
+    slow.budget = 5000;
+    run_one_scan_loop();
+    EXPECT_EQ(slow.overruns, 2);
+
+    task_scheduler_clear_stats();
+    EXPECT_EQ(slow.profile.count, 0);
+    EXPECT_EQ(slow.profile.sum, 0);
+    EXPECT_EQ(slow.profile.max, 0);
+}
@@ -104,6 +104,8 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+    key_action_cache_invalidate();
+    resolved_layer_cache_invalidate();
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -0,0 +1,6 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+PROFILING_ENABLE = yes
+
+SRC += ../test_tick_event_elision.cpp
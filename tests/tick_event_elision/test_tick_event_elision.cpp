@@ -0,0 +1,128 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Shared with tick_event_elision/disabled, so both builds are held to the same behavior.
+
+#include <cstdio>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiling.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class TickEventElision : public TestFixture {
+   protected:
+    TickEventElision() {
+        profiling_clear();
+    }
+
+    /* Number of tick events which ran through action_exec(). */
+    uint32_t tick_events(void) {
+        const profiling_probe_t* probe = profiling_find("tick event");
+        return probe ? probe->count : 0;
+    }
+};
+
+TEST_F(TickEventElision, IdleScansRunNoTickEvents) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    printf("tick events per 1000 idle scans: %u\n", (unsigned)tick_events());
+#ifdef TICK_EVENT_ELISION
+    EXPECT_EQ(tick_events(), 0);
+#else
+    EXPECT_GE(tick_events(), 999);
+#endif
+}
+
+TEST_F(TickEventElision, ModTapSettlesAsHoldAfterTappingTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, LSFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Only a tick event past the tapping term can settle the key. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Ticks ran while the key was pending, and stop once it settled. */
+    const uint32_t pending_ticks = tick_events();
+    EXPECT_GE(pending_ticks, TAPPING_TERM - 1);
+    idle_for(100);
+#ifdef TICK_EVENT_ELISION
+    EXPECT_EQ(tick_events(), pending_ticks);
+#endif
+}
+
+TEST_F(TickEventElision, ModTapTap) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, LSFT_T(KC_P));
+    auto       regular_key = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({mod_tap_key, regular_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TickEventElision, OneShotModTimesOut) {
+    TestDriver driver;
+    InSequence s;
+    auto       osm_key     = KeymapKey(0, 1, 0, OSM(MOD_LSFT));
+    auto       regular_key = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({osm_key, regular_key});
+
+    EXPECT_NO_REPORT(driver);
+    osm_key.press();
+    run_one_scan_loop();
+    osm_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The oneshot timeout is pending, so ticks keep running until it clears the mod. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(ONESHOT_TIMEOUT);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_GE(tick_events(), ONESHOT_TIMEOUT - 1);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -35,6 +35,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "connection.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 
@@ -140,8 +144,14 @@ void host_keyboard_send(report_keyboard_t *report) {
 
 #ifdef KEYBOARD_SHARED_EP
     report->report_id = REPORT_ID_KEYBOARD;
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report_begin();
 #endif
     (*driver->send_keyboard)(report);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report_end();
+#endif
 
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
@@ -157,7 +167,13 @@ void host_nkro_send(report_nkro_t *report) {
     if (!driver || !driver->send_nkro) return;
 
     report->report_id = REPORT_ID_NKRO;
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report_begin();
+#endif
     (*driver->send_nkro)(report);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report_end();
+#endif
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);